@@ -75,6 +75,12 @@ namespace Pulsar {
     //! The main loop
     virtual void run ();
 
+    //! Load, process, and finish the specified file
+    void process_file (const std::string& filename);
+
+    //! Return true if files may be processed in parallel
+    bool get_parallel_safe () const;
+
     //! Load file
     Archive* load (const std::string& filename);
 
@@ -100,6 +106,15 @@ namespace Pulsar {
     //! true if application receives a script name as the first file
     bool stow_script;
 
+    //! true if each file may be processed independently of the others
+    /*! Derived classes that accumulate results over multiple files,
+      or that use an interactive or shared graphics device, must set
+      this flag to false; see Application::run */
+    bool parallel_safe;
+
+    //! number of worker processes used to process files in parallel
+    unsigned nproc;
+
     // name of the application
     std::string name;
 
@@ -149,6 +164,9 @@ namespace Pulsar {
     //! Additional one-time final tasks
     virtual void finalize();
 
+    //! Return false if files cannot be processed in parallel
+    virtual bool get_parallel_safe () const { return true; }
+
   protected:
 
     friend class Application;
@@ -82,6 +82,12 @@ namespace Pulsar
     //! Factory returns a new instance loaded from filename
     static Archive* load (const std::string& name);
 
+    //! Sub-integrations and frequency channels to be loaded from file
+    class Selection;
+
+    //! Factory returns a new instance of the selected data in filename
+    static Archive* load (const std::string& name, const Selection*);
+
     //! Returns the number of Archive instances currently in existence
     static unsigned get_instance_count ();
 
@@ -590,6 +596,14 @@ namespace Pulsar
     //! Default policy for overwriting archive files
     static Option<bool> no_clobber;
 
+    //! Return true if load_header and load_Integration implement selection
+    /*! If true, load_header and load_Integration must return only the
+      data specified by get_selection, when it is set. */
+    virtual bool can_select () const { return false; }
+
+    //! Get the data selected for loading; null if all data are selected
+    const Selection* get_selection () const;
+
     //! Load the header information from filename
     virtual void load_header (const char* filename) = 0;
 
@@ -685,6 +699,9 @@ namespace Pulsar
       file when it is required. */
     std::string __load_filename;
 
+    //! The sub-integrations and frequency channels selected for loading
+    Reference::To<const Selection> load_selection;
+
     //! Clone sub-integrations during copy
     mutable std::vector<unsigned>* copy_subints;
     unsigned copy_nsubint () const;
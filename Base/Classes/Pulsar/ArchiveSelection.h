@@ -0,0 +1,85 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by Willem van Straten
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// psrchive/Base/Classes/Pulsar/ArchiveSelection.h
+
+#ifndef __Pulsar_ArchiveSelection_h
+#define __Pulsar_ArchiveSelection_h
+
+#include "Pulsar/Archive.h"
+
+namespace Pulsar {
+
+  //! Sub-integrations and frequency channels to be loaded from file
+  /*! By default, all sub-integrations and frequency channels are
+    selected.  A selection is passed to Archive::load (filename,
+    selection); derived classes that return true from can_select
+    read only the selected rows and channels from the file, while all
+    others are loaded in full and then reduced. */
+  class Archive::Selection : public Reference::Able {
+
+  public:
+
+    //! Default constructor selects all data
+    Selection ();
+
+    //! Select the specified sub-integration
+    /*! Sub-integrations are stored in the order in which they are added */
+    void add_subint (unsigned isubint);
+
+    //! Select the inclusive range of sub-integrations
+    void add_subints (unsigned first, unsigned last);
+
+    //! Select the inclusive range of frequency channels
+    void set_chan_range (unsigned first, unsigned last);
+
+    //! Return true if all sub-integrations are selected
+    bool get_all_subints () const { return subints.empty(); }
+
+    //! Return true if all frequency channels are selected
+    bool get_all_chans () const { return !chan_selected; }
+
+    //! Return the number of selected sub-integrations
+    /*! \param nsubint the number of sub-integrations in the file */
+    unsigned get_nsubint (unsigned nsubint) const;
+
+    //! Return the index in the file of the specified sub-integration
+    unsigned get_subint (unsigned isubint) const;
+
+    //! Return the indeces in the file of the selected sub-integrations
+    /*! \param nsubint the number of sub-integrations in the file */
+    std::vector<unsigned> get_subints (unsigned nsubint) const;
+
+    //! Return the number of selected frequency channels
+    /*! \param nchan the number of frequency channels in the file */
+    unsigned get_nchan (unsigned nchan) const;
+
+    //! Return the index in the file of the first selected channel
+    unsigned get_first_chan () const;
+
+    //! Throw an exception if the selection exceeds the file dimensions
+    void check (unsigned nsubint, unsigned nchan) const;
+
+  protected:
+
+    //! Indeces of the selected sub-integrations; empty if all selected
+    std::vector<unsigned> subints;
+
+    //! True if a range of frequency channels has been selected
+    bool chan_selected;
+
+    //! The first selected frequency channel
+    unsigned first_chan;
+
+    //! The last selected frequency channel
+    unsigned last_chan;
+  };
+
+}
+
+#endif
@@ -13,6 +13,7 @@
 
 #include "Pulsar/Pulsar.h"
 #include "Pulsar/Container.h"
+#include "Pulsar/ProfileAmps.h"
 
 #include "MJD.h"
 #include "Types.h"
@@ -502,6 +503,15 @@ namespace Pulsar {
 
     //! Set the number of phase bins to that of profiles[0][0]
     void update_nbin ();
+
+    //! Contiguous storage of the amplitudes of every profile
+    Reference::To<ProfileAmps::Arena> arena;
+
+    //! Store the amplitudes of every profile in a single arena
+    void pack (unsigned nbin);
+
+    //! Return true if every profile is stored in order in the arena
+    bool packed (unsigned nbin) const;
   };
 
   template<typename UnaryProfileMethod, typename Argument>
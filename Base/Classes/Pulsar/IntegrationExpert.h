@@ -113,6 +113,20 @@ namespace Pulsar {
     std::vector< std::vector< Reference::To<Profile> > >& profiles ()
     { return instance->profiles; }
 
+    //! Return the contiguous storage of every Profile amplitude
+    /*! Returns a null pointer if the profiles are not stored in a
+      single arena in (ipol,ichan) order; see ProfileAmps::Arena */
+    ProfileAmps::Arena* get_arena ()
+    { return packed() ? instance->arena.ptr() : 0; }
+
+    //! Return the contiguous storage of every Profile amplitude
+    const ProfileAmps::Arena* get_arena () const
+    { return packed() ? instance->arena.ptr() : 0; }
+
+    //! Store the amplitudes of every Profile in a single arena
+    void pack ()
+    { instance->pack (instance->get_nbin()); }
+
     //! Return true if the Integration has a parent Archive
     bool has_parent () const
     { return instance->parent; }
@@ -125,6 +139,9 @@ namespace Pulsar {
 
     //! instance
     Reference::To<Integration, false> instance;
+
+    bool packed () const
+    { return instance->packed (instance->get_nbin()); }
   };
 
 }
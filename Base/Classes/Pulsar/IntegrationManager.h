@@ -12,8 +12,11 @@
 #define __Pulsar_IntegrationManager_h
 
 #include "Pulsar/Container.h"
+#include "Pulsar/Config.h"
 
 #include <algorithm>
+#include <set>
+#include <inttypes.h>
 
 namespace Pulsar {
 
@@ -32,6 +35,9 @@ namespace Pulsar {
     //! A verbosity flag that can be set for debugging purposes
     static unsigned verbose;
 
+    //! Default limit on the memory used by loaded Integrations (in MB)
+    static Option<unsigned> default_memory_budget;
+
     //! null constructor
     IntegrationManager ();
 
@@ -75,6 +81,24 @@ namespace Pulsar {
     /*! This attribute may be set only through IntegrationManager::resize */
     virtual unsigned get_nsubint () const = 0;
 
+    //! Set the limit on the memory used by loaded Integrations (in bytes)
+    /*! When the total size of the loaded Integrations exceeds the
+      budget, the least recently used unmodified Integrations are
+      released and reloaded on demand.  Only Integrations accessed
+      through the const interface are considered unmodified; those
+      returned by the non-const get_Integration remain pinned in
+      memory, so read-only code should access the Archive through a
+      const pointer.  A const pointer to an Integration may be
+      invalidated by a later call to get_Integration unless a
+      Reference::To the Integration is held.  Zero disables the limit. */
+    void set_memory_budget (uint64_t bytes);
+
+    //! Get the limit on the memory used by loaded Integrations (in bytes)
+    uint64_t get_memory_budget () const { return memory_budget; }
+
+    //! Get the memory used by loaded Integrations (in bytes)
+    uint64_t get_memory_used () const { return memory_used; }
+
     //! Provides access to protected and private methods of IntegrationManager
     class Expert;
 
@@ -116,13 +140,46 @@ namespace Pulsar {
     void sort (StrictWeakOrdering comp = temporal_order)
     {
       load_all ();
+      forget ();
       std::sort (subints.begin(), subints.begin()+get_nsubint(), comp);
     }
 
     void load_all ();
 
+    //! Stop releasing Integrations and keep all subsequently loaded
+    /*! Called when the indeces of loaded Integrations no longer match
+      those in the file from which they were loaded */
+    void forget ();
+
   private:
 
+    //! Return the specified Integration, loading it if necessary
+    Integration* access (unsigned subint, bool modify);
+
+    //! Release unmodified Integrations until within the memory budget
+    void evict ();
+
+    //! Limit on the memory used by loaded Integrations
+    uint64_t memory_budget;
+
+    //! Memory used by loaded Integrations
+    uint64_t memory_used;
+
+    //! Memory used by each loaded Integration
+    std::vector<uint64_t> footprint;
+
+    //! Time of last access to each unmodified Integration
+    std::vector<uint64_t> last_used;
+
+    //! Unmodified Integrations, ordered by time of last access
+    std::set< std::pair<uint64_t,unsigned> > unmodified;
+
+    //! Counter incremented on each access
+    uint64_t access_count;
+
+    //! Integrations may be reloaded from file using their current index
+    bool file_order;
+
     //! The Integration vector
     /*!
       Access to Integrations must be made through the
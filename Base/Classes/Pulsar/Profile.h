@@ -110,6 +110,10 @@ namespace Pulsar {
     //! rotates the profile by phase (in turns)
     void rotate_phase (double phase);
 
+    //! rotates each profile by the corresponding phase (in turns)
+    static void rotate_phases (const std::vector<Profile*>& profiles,
+                               const std::vector<double>& phases);
+
     //! set all amplitudes to zero
     void zero ();
   
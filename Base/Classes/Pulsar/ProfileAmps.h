@@ -61,6 +61,18 @@ namespace Pulsar {
     /*! the indeces must be sorted and there must be no repeats */
     void remove (const std::vector<unsigned>& indeces);
 
+    //! Contiguous storage shared by many ProfileAmps instances
+    class Arena;
+
+    //! Use the specified element of the arena as the amplitudes array
+    void attach (Arena* arena, unsigned iprofile);
+
+    //! Return true if the amplitudes are stored in the specified element
+    bool attached (const Arena* arena, unsigned iprofile) const;
+
+    //! Return the arena that stores the amplitudes (null if owned by this)
+    const Arena* get_arena () const { return arena.ptr(); }
+
     //! expert interface
     class Expert;
 
@@ -77,6 +89,66 @@ namespace Pulsar {
     //! size of the amps array (always >= nbin)
     unsigned amps_size;
 
+    //! the arena that owns the amps array (null if owned by this)
+    Reference::To<Arena> arena;
+
+    //! release the amps array
+    void release ();
+
+  };
+
+  //! Contiguous storage shared by many ProfileAmps instances
+  /*! The amplitudes of nprofile profiles are stored in a single block
+    of memory, such that the first phase bin of profile iprofile is found
+    at an offset of iprofile*stride floats from the start of the block.
+
+    The stride is equal to nbin rounded up to the next multiple of four,
+    so that every profile begins on a 16-byte boundary.  When used by
+    Integration, the amplitudes of the profile at (ipol,ichan) are found
+    at offset (ipol*nchan + ichan)*stride + ibin.
+
+    The arena remains allocated for as long as any ProfileAmps instance
+    refers to it; therefore, a Profile that is removed from or swapped
+    out of an Integration remains valid.
+  */
+  class ProfileAmps::Arena : public Reference::Able {
+
+  public:
+
+    //! Construct storage for nprofile profiles of nbin phase bins
+    Arena (unsigned nprofile, unsigned nbin);
+
+    //! Destructor frees the block of memory
+    ~Arena ();
+
+    //! Return the number of profiles
+    unsigned get_nprofile () const { return nprofile; }
+
+    //! Return the number of phase bins in each profile
+    unsigned get_nbin () const { return nbin; }
+
+    //! Return the offset between consecutive profiles
+    unsigned get_stride () const { return stride; }
+
+    //! Return a pointer to the amplitudes of the specified profile
+    float* get_amps (unsigned iprofile = 0);
+
+    //! Return a pointer to the amplitudes of the specified profile
+    const float* get_amps (unsigned iprofile = 0) const;
+
+  private:
+
+    //! the block of memory
+    float* amps;
+
+    //! number of profiles
+    unsigned nprofile;
+
+    //! number of phase bins in each profile
+    unsigned nbin;
+
+    //! offset between consecutive profiles
+    unsigned stride;
   };
 
 }
@@ -13,6 +13,8 @@
 
 #include "Pulsar/ProfileAmps.h"
 
+#include <algorithm>
+
 namespace Pulsar {
 
   //! Provides access to private and protected members of ProfileAmps
@@ -35,6 +37,16 @@ namespace Pulsar {
     static void set_amps_ptr (ProfileAmps* instance, float* amps)
     { instance->amps = amps; }
 
+    //! Exchange the amplitudes arrays of two instances
+    /*! Unlike set_amps_ptr, this method also exchanges ownership of
+      the arrays, which is necessary when either is stored in an Arena */
+    static void swap_amps (ProfileAmps* a, ProfileAmps* b)
+    {
+      std::swap (a->amps, b->amps);
+      std::swap (a->amps_size, b->amps_size);
+      std::swap (a->arena, b->arena);
+    }
+
   private:
 
     //! instance
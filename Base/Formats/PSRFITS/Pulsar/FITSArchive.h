@@ -33,6 +33,7 @@ namespace Pulsar
   class DigitiserCounts;
   class FITSSUBHdrExtension;
   class ProfileColumn;
+  class FITSMemoryMap;
   class CoherentDedispersion;
   class SpectralKurtosis;
   class ObsDescription;
@@ -94,6 +95,9 @@ namespace Pulsar
     //! Return the name of the PSRFITS definition template file
     static std::string get_template_name ();
 
+    //! Decode profiles directly from a memory map of uncompressed files
+    static Option<bool> use_memory_map;
+
     //! Unload FITSHdrExtension to the current HDU of the specified FITS file
     static void unload (fitsfile* fptr, const FITSHdrExtension*);
 
@@ -192,6 +196,9 @@ namespace Pulsar
     //! The unload_file method is implemented
     bool can_unload () const { return true; }
 
+    //! Only the selected rows and channels are read from file
+    bool can_select () const { return true; }
+
     //! Unload the FITSArchive (header and Integration data) to filename
     virtual void unload_file (const char* filename) const;
 
@@ -305,6 +312,12 @@ namespace Pulsar
     // Flag set when data are loaded from a PSRFITS file
     bool loaded_from_fits;
 
+    // Number of frequency channels in the file
+    unsigned file_nchan;
+
+    // Reduce the header to the selected sub-integrations and channels
+    void apply_selection ();
+
     //! Number of auxiliary profiles stored in each channel
     mutable unsigned naux_profile;
 
@@ -333,6 +346,9 @@ namespace Pulsar
 
     // Name of file used for reading 
     std::string read_filename;
+
+    // Memory map of file used for reading (only)
+    Reference::To<FITSMemoryMap> read_map;
   };
 
 }
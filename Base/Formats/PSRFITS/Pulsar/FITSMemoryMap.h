@@ -0,0 +1,58 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by Willem van Straten
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// psrchive/Base/Formats/PSRFITS/Pulsar/FITSMemoryMap.h
+
+#ifndef __Pulsar_FITSMemoryMap_h
+#define __Pulsar_FITSMemoryMap_h
+
+#include "ReferenceAble.h"
+
+#include <string>
+#include <inttypes.h>
+
+namespace Pulsar {
+
+  //! Read-only memory map of an uncompressed FITS file
+  /*! The mapped bytes are an exact image of the file on disk, so that
+    binary table cells may be decoded directly from the kernel page
+    cache without passing through the cfitsio buffers. */
+  class FITSMemoryMap : public Reference::Able {
+
+  public:
+
+    //! Return true if filename is a plain FITS file that can be mapped
+    static bool mappable (const std::string& filename);
+
+    //! Map the named file into memory
+    FITSMemoryMap (const std::string& filename);
+
+    //! Unmap the file
+    ~FITSMemoryMap ();
+
+    //! Get the name of the mapped file
+    const std::string& get_filename () const { return filename; }
+
+    //! Get the size of the mapped file in bytes
+    uint64_t get_size () const { return size; }
+
+    //! Get a pointer to the byte at the specified offset from file start
+    const unsigned char* get_data (uint64_t offset = 0) const
+    { return base + offset; }
+
+  protected:
+
+    std::string filename;
+    const unsigned char* base;
+    uint64_t size;
+
+  };
+
+}
+
+#endif
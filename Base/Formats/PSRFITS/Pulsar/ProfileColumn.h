@@ -11,13 +11,15 @@
 #ifndef __Pulsar_ProfileColumn_h
 #define __Pulsar_ProfileColumn_h
 
-#include "Reference.h"
+#include "ReferenceTo.h"
 
 #include <fitsio.h>
+#include <inttypes.h>
 
 namespace Pulsar {
 
   class Profile;
+  class FITSMemoryMap;
 
   //! Loads and unloads Profile vector from PSRFITS archives
 
@@ -28,9 +30,18 @@ namespace Pulsar {
     //! Default constructor
     ProfileColumn ();
 
+    //! Destructor
+    ~ProfileColumn ();
+
     //! Set the fitsfile to/from which data are written/read
     void set_fitsfile (fitsfile* fptr);
 
+    //! Set the memory map from which data may be decoded directly
+    /*! When set, load decodes the cells of the current row directly from
+      the mapped file, falling back to cfitsio if the binary table layout
+      cannot be interpreted without it. */
+    void set_memory_map (const FITSMemoryMap*);
+
     //! Set the name of the data column
     void set_data_colname (const std::string&);
 
@@ -58,6 +69,11 @@ namespace Pulsar {
     //! Set the number of profiles in each frequency channel
     void set_nprof (unsigned);
 
+    //! Set the range of frequency channels to be loaded
+    /*! By default, all nchan channels are loaded; otherwise, count
+      channels starting at first are loaded. */
+    void set_chan_range (unsigned first, unsigned count);
+
     //! Resize the columns
     void resize ();
 
@@ -86,6 +102,39 @@ namespace Pulsar {
 
     unsigned nbin, nchan, nprof;
 
+    //! The range of frequency channels to be loaded
+    unsigned chan_first, chan_count;
+
+    //! Optional memory map of the file opened by fptr
+    Reference::To<const FITSMemoryMap> map;
+
+    //! Location of the columns within the memory map
+    struct MapLayout
+    {
+      //! The layout has been determined for the current HDU
+      bool checked;
+      //! The columns may be decoded from the memory map
+      bool valid;
+      //! Offset of the first row from the start of the file
+      uint64_t datastart;
+      //! Number of bytes in each row
+      uint64_t row_bytes;
+      //! Number of rows
+      uint64_t nrow;
+      //! Offset of each column from the start of the row
+      uint64_t data_byte, offset_byte, scale_byte;
+      //! Number of elements in the offset and scale columns
+      unsigned nscale;
+    };
+
+    MapLayout layout;
+
+    //! Determine the layout of the columns within the memory map
+    bool setup_map ();
+
+    //! Return a pointer to the start of the specified row in the memory map
+    const unsigned char* get_mapped_row (int row) const;
+
     //! reset the column indeces
     void reset ();
 
@@ -94,6 +143,10 @@ namespace Pulsar {
 
     template<typename T, typename C>
     void load_amps (int row, C&);
+
+    //! Read the offset and scale columns of the specified row
+    void load_scales (int row, std::vector<float>& offsets,
+                      std::vector<float>& scales);
   };
 
 }
@@ -173,6 +173,9 @@ namespace Pulsar {
     //! The unload_file method is implemented
     bool can_unload () const { return true; }
 
+    //! Only the selected sub-integrations are kept while loading
+    bool can_select () const { return true; }
+
     //! Unload the Archive (header and Integration data) to filename
     virtual void unload_file (const char* filename) const;
 
@@ -0,0 +1,123 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by Willem van Straten
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// psrchive/More/General/Pulsar/ChannelStatistics.h
+
+#ifndef __Pulsar_ChannelStatistics_h
+#define __Pulsar_ChannelStatistics_h
+
+#include "ReferenceTo.h"
+#include <vector>
+
+namespace Pulsar {
+
+  class Archive;
+  class PhaseWeight;
+
+  //! Moments of the total intensity in every sub-integration and channel
+  /*! The statistics of all profiles are computed in a single pass over
+    the data, in storage order.  The total intensity is the sum of the
+    first two polarizations when the state is PPQQ or Coherence;
+    otherwise, it is the first polarization.
+
+    The results may be shared by different channel weighting
+    algorithms, and by psrstat, so that the archive is read only
+    once.  The statistics are not updated when the data are modified;
+    the weights, which are not used, may change freely.
+  */
+  class ChannelStatistics : public Reference::Able
+  {
+
+  public:
+
+    //! Default constructor
+    ChannelStatistics ();
+
+    //! Set the phase bins used to compute the baseline statistics
+    /*! If not set, all phase bins are used */
+    void set_baseline (const PhaseWeight*);
+
+    //! Compute the statistics of every profile in the archive
+    void compute (const Archive*);
+
+    //! Return true if the statistics were computed from the archive
+    bool computed_from (const Archive*) const;
+
+    //! Force the statistics to be recomputed (e.g. after modifying the data)
+    void reset ();
+
+    //! Get the number of sub-integrations
+    unsigned get_nsubint () const { return nsubint; }
+
+    //! Get the number of frequency channels
+    unsigned get_nchan () const { return nchan; }
+
+    //! Get the sum of the total intensity
+    double get_sum (unsigned isub, unsigned ichan) const;
+
+    //! Get the mean of the total intensity
+    double get_mean (unsigned isub, unsigned ichan) const;
+
+    //! Get the variance of the total intensity
+    double get_variance (unsigned isub, unsigned ichan) const;
+
+    //! Get the standard deviation of the total intensity
+    double get_rms (unsigned isub, unsigned ichan) const;
+
+    //! Get the modulation index, rms / mean
+    double get_modulation_index (unsigned isub, unsigned ichan) const;
+
+    //! Get the minimum total intensity
+    float get_min (unsigned isub, unsigned ichan) const;
+
+    //! Get the maximum total intensity
+    float get_max (unsigned isub, unsigned ichan) const;
+
+    //! Get the mean of the total intensity in the baseline
+    double get_baseline_mean (unsigned isub, unsigned ichan) const;
+
+    //! Get the variance of the total intensity in the baseline
+    double get_baseline_variance (unsigned isub, unsigned ichan) const;
+
+  protected:
+
+    //! Sums accumulated over the phase bins of one profile
+    class Moments
+    {
+    public:
+      //! Subtracted from each sample to reduce round-off error
+      double offset;
+      double sum, sumsq;
+      unsigned count;
+
+      double baseline_sum, baseline_sumsq;
+      unsigned baseline_count;
+
+      float min, max;
+    };
+
+    //! Moments of each profile, indexed by isub*nchan + ichan
+    std::vector<Moments> moments;
+
+    //! Return the moments of the specified profile
+    const Moments& get (unsigned isub, unsigned ichan) const;
+
+    //! The archive from which the statistics were computed
+    Reference::To<const Archive,false> archive;
+
+    unsigned nsubint;
+    unsigned nchan;
+    unsigned nbin;
+
+    //! The phase bins used to compute the baseline statistics
+    Reference::To<const PhaseWeight> baseline;
+  };
+
+}
+
+#endif
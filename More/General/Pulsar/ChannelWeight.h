@@ -12,6 +12,7 @@
 #define _Pulsar_ChannelWeight_H
 
 #include "Pulsar/Weight.h"
+#include "Pulsar/ChannelStatistics.h"
 
 namespace Pulsar {
   
@@ -20,6 +21,35 @@ namespace Pulsar {
       channel weighting algorithms, such as RFI excision. */
   class ChannelWeight : public Weight {
 
+  public:
+
+    //! Default constructor
+    ChannelWeight ();
+
+    //! Set the channel statistics, which may be shared with other algorithms
+    void set_statistics (ChannelStatistics*);
+
+    //! Get the channel statistics
+    ChannelStatistics* get_statistics () const;
+
+    //! Set the weights of all Profiles in the Archive
+    void operator () (Archive*);
+
+  protected:
+
+    //! Return the statistics of the current archive, computing if necessary
+    /*! Returns null if no archive is being weighted */
+    const ChannelStatistics* update_statistics ();
+
+    //! The channel statistics
+    Reference::To<ChannelStatistics> statistics;
+
+    //! The archive being weighted
+    const Archive* current_archive;
+
+    //! The index of the sub-integration being weighted
+    unsigned current_subint;
+
   };
   
 }
@@ -16,6 +16,10 @@
 #include "Pulsar/Archive.h"
 #include "Pulsar/Profile.h"
 #include "Physical.h"
+#include "BatchQueue.h"
+
+#include <vector>
+#include <algorithm>
 
 namespace Pulsar {
 
@@ -42,7 +46,7 @@ namespace Pulsar {
     typedef typename Corrector::Return Type;
 
     //! Default constructor
-    ColdPlasma () { name = "ColdPlasma"; }
+    ColdPlasma () { name = "ColdPlasma"; nthread = 1; }
 
     //! Return the measure to be corrected with respect to centre frequency
     virtual double get_correction_measure (const Integration*) = 0;
@@ -77,6 +81,20 @@ namespace Pulsar {
     //! The default correction
     void transform (Integration*);
 
+    //! Perform the default correction on each sub-integration in an Archive
+    void transform_each (Archive*);
+
+    //! Set the number of threads used to correct sub-integrations
+    void set_nthread (unsigned n) { nthread = n; }
+    //! Get the number of threads used to correct sub-integrations
+    unsigned get_nthread () const { return nthread; }
+
+    //! Return a new instance with the same correction attributes
+    /*! Each thread corrects its sub-integrations using its own instance.
+      If a derived class does not override this method, sub-integrations
+      are always corrected serially. */
+    virtual ColdPlasma* clone () const { return 0; }
+
     //! Set up internal variables before execution
     /*! \post reference_frequency = Integration::get_centre_frequency */
     void setup (const Integration*);
@@ -134,6 +152,49 @@ namespace Pulsar {
     //! Execute the correction on the selected range
     void range (Integration*, unsigned ichan, unsigned jchan);
 
+    //! Apply the correction to each channel in the selected range
+    /*! Derived classes may override this method to correct all of the
+      channels in the range at once. */
+    virtual void apply_range (Integration*, unsigned ichan, unsigned jchan);
+
+    //! Copy the measure, reference wavelength and delta of another instance
+    void copy_correction (const ColdPlasma*);
+
+    //! Called before sub-integrations are corrected by multiple threads
+    virtual void start_threads () { }
+
+    //! Called after all threads have finished
+    virtual void finish_threads () { }
+
+    //! Method called for each sub-integration
+    typedef void (ColdPlasma::*Method) (Integration*);
+
+    //! Sub-integrations corrected by a single thread
+    class Block : public Reference::Able
+    {
+    public:
+      Block () { method = 0; error = 0; }
+      ~Block () { delete error; }
+
+      //! The instance used by the thread
+      Reference::To<ColdPlasma> worker;
+      //! The sub-integrations to be corrected
+      std::vector<Integration*> subints;
+      //! The method to be called for each sub-integration
+      Method method;
+      //! The exception thrown by the method, if any
+      Error* error;
+    };
+
+    //! Call method for each sub-integration in the block
+    void correct_block (Block*);
+
+    //! Call method for each sub-integration, using up to nthread threads
+    void foreach_subint (Archive*, Method);
+
+    //! The number of threads used to correct sub-integrations
+    unsigned nthread;
+
     //! The dielectric effect corrector
     Corrector corrector;
 
@@ -176,18 +237,120 @@ catch (Error& error)
   throw error += "Pulsar::" + name + "::transform";
 }
 
+template<class C, class H>
+void Pulsar::ColdPlasma<C,H>::transform_each (Archive* arch)
+{
+  foreach_subint (arch, &ColdPlasma::transform);
+}
+
 template<class C, class H>
 void Pulsar::ColdPlasma<C,H>::execute (Archive* arch)
 {
-  for (unsigned i=0; i<arch->get_nsubint(); i++)
-    execute1( arch->get_Integration(i) );
+  foreach_subint (arch, &ColdPlasma::execute1);
 }
 
 template<class C, class H>
 void Pulsar::ColdPlasma<C,H>::revert (Archive* arch)
 {
-  for (unsigned i=0; i<arch->get_nsubint(); i++)
-    revert1( arch->get_Integration(i) );
+  foreach_subint (arch, &ColdPlasma::revert1);
+}
+
+/*! The state of this instance that is modified while correcting a
+  sub-integration (the frequency of the corrector, the delta and any
+  attributes of derived classes) is either restored or reset before
+  the next sub-integration is corrected.  Therefore, each thread may
+  correct a contiguous block of sub-integrations using its own clone,
+  and the results are identical to those of the serial loop.
+
+  The sub-integrations are retrieved by the calling thread before any
+  worker is started, so that an Archive that loads them on demand is
+  never accessed concurrently.
+*/
+template<class C, class H>
+void Pulsar::ColdPlasma<C,H>::foreach_subint (Archive* arch, Method method)
+try
+{
+  const unsigned nsubint = arch->get_nsubint();
+
+  Reference::To<ColdPlasma> worker;
+  if (nthread > 1 && nsubint > 1)
+    worker = clone ();
+
+  if (!worker)
+  {
+    for (unsigned isub=0; isub < nsubint; isub++)
+      (this->*method) ( arch->get_Integration(isub) );
+    return;
+  }
+
+  const unsigned nblock = std::min (nthread, nsubint);
+
+  if (Integration::verbose)
+    std::cerr << "Pulsar::"+name+"::foreach_subint nsubint=" << nsubint
+	      << " nthread=" << nblock << std::endl;
+
+  std::vector< Reference::To<Block> > blocks (nblock);
+
+  for (unsigned iblock=0; iblock < nblock; iblock++)
+  {
+    Block* block = blocks[iblock] = new Block;
+
+    if (iblock == 0)
+      block->worker = worker;
+    else
+      block->worker = clone ();
+
+    block->method = method;
+
+    unsigned start = (iblock * nsubint) / nblock;
+    unsigned end = ((iblock+1) * nsubint) / nblock;
+
+    for (unsigned isub=start; isub < end; isub++)
+      block->subints.push_back( arch->get_Integration(isub) );
+  }
+
+  start_threads ();
+
+  BatchQueue queue (nblock);
+
+  for (unsigned iblock=0; iblock < nblock; iblock++)
+    queue.submit( blocks[iblock]->worker.get(), &ColdPlasma::correct_block,
+		  blocks[iblock].get() );
+
+  queue.wait ();
+
+  finish_threads ();
+
+  for (unsigned iblock=0; iblock < nblock; iblock++)
+    if (blocks[iblock]->error)
+      throw *(blocks[iblock]->error);
+}
+catch (Error& error)
+{
+  throw error += "Pulsar::"+name+"::foreach_subint";
+}
+
+template<class C, class H>
+void Pulsar::ColdPlasma<C,H>::correct_block (Block* block)
+{
+  try
+  {
+    for (unsigned isub=0; isub < block->subints.size(); isub++)
+      (this->*(block->method)) ( block->subints[isub] );
+  }
+  catch (Error& error)
+  {
+    block->error = new Error (error);
+  }
+}
+
+template<class C, class H>
+void Pulsar::ColdPlasma<C,H>::copy_correction (const ColdPlasma* other)
+{
+  set_measure( other->get_measure() );
+  set_reference_wavelength( other->get_reference_wavelength() );
+  set_delta( other->get_delta() );
+  set_nthread( other->get_nthread() );
 }
 
 template<class C, class H>
@@ -396,14 +559,20 @@ void Pulsar::ColdPlasma<C,H>::range (Integration* data,
     throw Error (InvalidRange, "Pulsar::"+name+"::range",
                  "end chan=%d > nchan=%d", kchan, data->get_nchan());
 
+  apply_range (data, ichan, kchan);
+}
+catch (Error& error) {
+  throw error += "Pulsar::"+name+"::range";
+}
+
+template<class C, class H>
+void Pulsar::ColdPlasma<C,H>::apply_range (Integration* data,
+					   unsigned ichan, unsigned kchan)
+{
   for (unsigned jchan=ichan; jchan < kchan; jchan++) {
     corrector.set_frequency( data->get_centre_frequency (jchan) );
     apply (data, jchan);
   }
-
-}
-catch (Error& error) {
-  throw error += "Pulsar::"+name+"::range";
 }
 
 
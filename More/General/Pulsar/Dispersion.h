@@ -17,6 +17,8 @@
 #include "Pulsar/Dedisperse.h"
 #include "Pulsar/IntegrationBarycentre.h"
 
+class ThreadContext;
+
 namespace Pulsar {
 
   //! Corrects dispersive delays
@@ -56,12 +58,21 @@ namespace Pulsar {
     //! Phase rotate each profile by the correction
     void apply (Integration*, unsigned channel);
 
+    //! Phase rotate all profiles in the range of channels at once
+    void apply_range (Integration*, unsigned ichan, unsigned kchan);
+
     //! Apply the current correction to all sub-integrations in an archive
     void execute (Archive*);
 
     //! Undo the correction
     void revert (Archive*);
 
+    //! Return a new instance with the same correction attributes
+    Dispersion* clone () const;
+
+    //! The default number of threads used to correct sub-integrations
+    static Option<unsigned> default_nthread;
+
     //! Set the dispersion measure
     void set_dispersion_measure (double dispersion_measure)
     { set_measure (dispersion_measure); }
@@ -81,6 +92,15 @@ namespace Pulsar {
     IntegrationBarycentre bary;
     double earth_doppler;
 
+    //! Install a ThreadContext that serializes the creation of FFT plans
+    void start_threads ();
+
+    //! Restore the ThreadContext that was installed before start_threads
+    void finish_threads ();
+
+    //! The FFT plan ThreadContext that was installed before start_threads
+    ThreadContext* saved_context;
+
   };
 
 }
@@ -42,6 +42,9 @@ namespace Pulsar
     //! Return name of flux algorithm
     virtual std::string get_method() const { return ""; }
 
+    //! Return a copy constructed instance of self
+    virtual Flux* clone () const = 0;
+
   protected:
 
   };
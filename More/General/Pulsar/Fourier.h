@@ -17,6 +17,7 @@ namespace Pulsar {
 
   class Profile;
   class PolnProfile;
+  class Integration;
 
   //! Return the forward Fourier transform of the input Profile
   Profile* fourier_transform (const Profile*,
@@ -26,6 +27,19 @@ namespace Pulsar {
   PolnProfile* fourier_transform (const PolnProfile*,
 				  FTransform::Plan* = 0);
 
+  //! Compute the forward Fourier transforms of many Profiles at once
+  /*! Every input Profile must have the same number of phase bins.  The
+    transforms are computed by a single batched FFT and stored in one
+    contiguous block of memory shared by the output Profiles. */
+  void fourier_transform (const std::vector<const Profile*>& input,
+			  std::vector< Reference::To<Profile> >& output);
+
+  //! Compute the forward Fourier transform of every Profile in an Integration
+  /*! On return, output[ipol*nchan+ichan] is the transform of the
+    Profile at (ipol,ichan). */
+  void fourier_transform (const Integration* input,
+			  std::vector< Reference::To<Profile> >& output);
+
   //! Return the forward Fourier transform of the input Profile
   Profile* complex_fourier_transform (const Profile*,
 				      FTransform::Plan* = 0);
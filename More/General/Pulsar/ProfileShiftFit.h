@@ -55,6 +55,12 @@ namespace Pulsar
     //! Default constructor
     ProfileShiftFit ();
 
+    //! Copy constructor
+    ProfileShiftFit (const ProfileShiftFit&);
+
+    //! Assignment operator
+    const ProfileShiftFit& operator = (const ProfileShiftFit&);
+
     //! Destructor
     ~ProfileShiftFit();
 
@@ -174,6 +180,9 @@ namespace Pulsar
     //! Evaluate d^2(ccf)/d(phi)^2 at phase shift phi
     double d2ccf(double phi);
 
+    //! Throw an exception if the ccf has not been computed
+    void check_ccf (const char* method) const;
+
     //! Returns log of a value proportional to the posterior shift PDF
     double log_shift_pdf(double phi);
 
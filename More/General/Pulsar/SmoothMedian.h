@@ -12,6 +12,7 @@
 #define __Pulsar_SmoothMedian_h
 
 #include "Pulsar/Smooth.h"
+#include "SlidingMedian.h"
 
 namespace Pulsar {
 
@@ -36,6 +37,20 @@ namespace Pulsar {
 
     void transform (Profile*);
 
+    //! Write the median smoothed amplitudes of input to result
+    /*! Neither result nor input are resized; both must have nbin elements */
+    void smooth (float* result, const float* input, unsigned nbin);
+
+  protected:
+
+    //! Return the odd number of phase bins in the window
+    unsigned get_window (unsigned nbin);
+
+    //! The sorted window, reused by each call to smooth
+    SlidingMedian<float> window;
+
+    //! The smoothed amplitudes, reused by each call to transform
+    std::vector<float> result;
   };
 
 }
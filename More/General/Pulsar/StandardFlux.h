@@ -34,6 +34,9 @@ namespace Pulsar
     //! Return name of flux algorithm
     std::string get_method() const { return "StandardFlux"; }
 
+    //! Return a copy constructed instance of self
+    StandardFlux* clone () const { return new StandardFlux(*this); }
+
     //! Set the standard profile to use
     void set_standard(const Profile *p);
 
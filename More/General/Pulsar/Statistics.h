@@ -21,6 +21,7 @@ namespace Pulsar {
   class Integration;
   class Profile;
   class ProfileStats;
+  class ChannelStatistics;
   class PhaseWeight;
   class SNRatioEstimator;
   class WidthEstimator;
@@ -93,6 +94,32 @@ namespace Pulsar {
     //! Get the Profile statistics interface
     ProfileStats* get_stats ();
 
+    //! Get the mean total intensity of the current sub-integration and channel
+    double get_channel_mean () const;
+
+    //! Get the rms total intensity of the current sub-integration and channel
+    double get_channel_rms () const;
+
+    //! Get the modulation index of the current sub-integration and channel
+    double get_channel_modulation () const;
+
+    //! Get the first quartile of the modulation index of all profiles
+    double get_channel_modulation_Q1 () const;
+
+    //! Get the median modulation index of all profiles
+    double get_channel_modulation_median () const;
+
+    //! Get the third quartile of the modulation index of all profiles
+    double get_channel_modulation_Q3 () const;
+
+    //! Get the statistics of every sub-integration and channel
+    /*! Computed in a single pass on first use after set_Archive */
+    const ChannelStatistics* get_channel_statistics () const;
+
+    //! Set the channel statistics, which may be shared with other algorithms
+    /*! Must be called after set_Archive, which resets the statistics */
+    void set_channel_statistics (ChannelStatistics*);
+
     //! Get the weighted frequency from the Pulsar::Archive
     double get_weighted_frequency () const;
 
@@ -131,6 +158,12 @@ namespace Pulsar {
     const Integration* get_Integration () const;
     mutable Reference::To<const Integration, false> integration;
 
+    mutable Reference::To<ChannelStatistics> channel_stats;
+
+    //! Quartiles of the modulation index of profiles with non-zero weight
+    double get_modulation_quartile (unsigned iq) const;
+    mutable std::vector<float> modulation_quartiles;
+
     mutable std::vector< Reference::To<Plugin> > plugins;
 
     Reference::To<SNRatioEstimator> snr_estimator;
@@ -0,0 +1,128 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by Willem van Straten
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// psrchive/More/General/Pulsar/TimeFrequencyPyramid.h
+
+#ifndef __Pulsar_TimeFrequencyPyramid_h
+#define __Pulsar_TimeFrequencyPyramid_h
+
+#include "ReferenceTo.h"
+#include <vector>
+
+namespace Pulsar {
+
+  //! Multi-resolution summary of a statistic in each sub-integration and channel
+  /*! Level 0 stores the value and weight of each sub-integration and
+    frequency channel.  Each tile at level k summarizes 2x2 tiles at
+    level k-1 by their total weight and weighted mean, so that level k
+    has 2^k times fewer sub-integrations and channels than level 0.
+
+    When a weight is changed, only the tiles that contain it are marked
+    for update; the next call to update recomputes only those tiles,
+    from the bottom level to the top.  Zapping a channel therefore costs
+    O(nsubint) rather than O(nsubint*nchan) operations.
+  */
+  class TimeFrequencyPyramid : public Reference::Able
+  {
+
+  public:
+
+    //! Default constructor
+    TimeFrequencyPyramid ();
+
+    //! Set the number of sub-integrations and channels; all weights are zero
+    void resize (unsigned nsubint, unsigned nchan);
+
+    //! Get the number of levels
+    unsigned get_nlevel () const { return levels.size() + 1; }
+
+    //! Get the number of sub-integrations (tiles) at the specified level
+    unsigned get_nsubint (unsigned level = 0) const;
+
+    //! Get the number of channels (tiles) at the specified level
+    unsigned get_nchan (unsigned level = 0) const;
+
+    //! Set the value and weight of the specified sub-integration and channel
+    void set (unsigned isub, unsigned ichan, float value, float weight);
+
+    //! Set the weight of the specified sub-integration and channel
+    void set_weight (unsigned isub, unsigned ichan, float weight);
+
+    //! Recompute the tiles that contain modified values or weights
+    void update ();
+
+    //! Get the number of tiles recomputed by the last call to update
+    unsigned get_nupdated () const { return nupdated; }
+
+    //! Get the weighted mean of the specified tile
+    /*! Returns zero if all of the weights in the tile are zero */
+    float get_mean (unsigned level, unsigned isub, unsigned ichan) const;
+
+    //! Get the total weight of the specified tile
+    float get_weight (unsigned level, unsigned isub, unsigned ichan) const;
+
+    //! Get the finest level at which the range fits in the number of tiles
+    unsigned get_level (unsigned nsubint, unsigned nchan,
+			unsigned max_nsubint, unsigned max_nchan) const;
+
+  protected:
+
+    //! Summary of 2x2 tiles at the next finer level
+    class Tile
+    {
+    public:
+      float weight;
+      float mean;
+    };
+
+    //! A level with nsubint by nchan tiles, indexed by isub*nchan + ichan
+    class Level
+    {
+    public:
+      unsigned nsubint;
+      unsigned nchan;
+      std::vector<Tile> tiles;
+
+      //! Non-zero if the tile must be recomputed
+      std::vector<char> modified;
+
+      //! Indeces of the tiles that must be recomputed
+      std::vector<unsigned> to_update;
+    };
+
+    //! Value of each sub-integration and channel at level 0
+    std::vector<float> values;
+
+    //! Weight of each sub-integration and channel at level 0
+    std::vector<float> weights;
+
+    unsigned nsubint;
+    unsigned nchan;
+
+    //! Levels 1 and higher
+    std::vector<Level> levels;
+
+    unsigned nupdated;
+
+    //! Mark the tile at level that contains isub and ichan at level-1
+    void modify (unsigned level, unsigned isub, unsigned ichan);
+
+    //! Recompute the specified tile at level 1 or higher
+    void compute (unsigned level, unsigned isub, unsigned ichan);
+
+    //! Get the summary of a tile at any level
+    Tile get_tile (unsigned level, unsigned isub, unsigned ichan) const;
+
+    //! Throw an exception if the tile does not exist
+    void check (const char* method,
+		unsigned level, unsigned isub, unsigned ichan) const;
+  };
+
+}
+
+#endif
@@ -14,6 +14,9 @@
 
 namespace Pulsar {
 
+  class ProfileStats;
+  class TimeFrequencyPyramid;
+
   //! Plots off-pulse mean or variance as a func of time and freq.
   class DynamicBaselineSpectrumPlot : public DynamicSpectrumPlot {
 
@@ -36,12 +39,24 @@ namespace Pulsar {
 
     void get_plot_array(const Archive *data, float *array);
 
+    //! Draw in the current viewport
+    void draw (const Archive*);
+
     bool get_use_variance() const { return use_variance; }
     void set_use_variance(bool flag=true ) { use_variance = flag; }
 
     bool get_reuse_baseline() const { return reuse_baseline; }
     void set_reuse_baseline(bool flag=true ) { reuse_baseline = flag; }
 
+    //! Cache the statistics and draw them at the resolution of the viewport
+    /*! The statistics of every profile are computed once and stored in
+      a multi-resolution pyramid.  When the same archive is plotted
+      again, only the weights are compared, and only the tiles that
+      contain modified weights are recomputed.  The data must not be
+      modified while caching is enabled. */
+    bool get_cache() const { return cache; }
+    void set_cache(bool flag=true ) { cache = flag; }
+
     //! Set the ProfileStats expression to evaluate
     void set_expression (const std::string& str) { expression = str; }
     std::string get_expression () const { return expression; }
@@ -54,6 +69,28 @@ namespace Pulsar {
 
     // expression evaluated by ProfileStats
     std::string expression;
+
+    //! Set up the estimator and return a dedispersed copy of the data
+    Reference::To<const Archive> setup_estimator (const Archive*);
+
+    //! Return the value of the statistic derived from the profile
+    float get_value (const Profile*);
+
+    Reference::To<ProfileStats> stats;
+    Reference::To<TextInterface::Parser> parser;
+    Reference::To<PhaseWeight> window;
+
+    bool cache;
+
+    //! Compute or update the cached statistics
+    void update_pyramid (const Archive*);
+
+    //! Describes the configuration on which the cached statistics depend
+    std::string get_cache_key () const;
+
+    Reference::To<TimeFrequencyPyramid> pyramid;
+    Reference::To<const Archive,false> cached_archive;
+    std::string cached_key;
   };
 
 }
@@ -67,6 +67,11 @@ namespace Pulsar {
 
   protected:
 
+    //! Draw an image of nsub by nchan pixels
+    /*! The first pixel spans x_min to x_min+x_res and y_min to y_min+y_res */
+    void draw_image (const float* array, unsigned nsub, unsigned nchan,
+		     float x_min, float x_res, float y_min, float y_res);
+
     pgplot::ColourMap colour_map;
 
     int pol;
@@ -50,6 +50,9 @@ namespace Pulsar {
     //! Close the plot device
     void finalize ();
 
+    //! The plot device cannot be shared by multiple processes
+    bool get_parallel_safe () const { return false; }
+
   private:
 
     //! Add options to the menu
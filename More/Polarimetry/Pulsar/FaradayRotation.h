@@ -13,6 +13,7 @@
 
 #include "Pulsar/ColdPlasma.h"
 
+#include "Pulsar/Config.h"
 #include "Pulsar/Faraday.h"
 #include "Pulsar/DeFaraday.h"
 
@@ -63,6 +64,12 @@ namespace Pulsar {
     //! Undo the correction
     void revert (Archive*);
 
+    //! Return a new instance with the same correction attributes
+    FaradayRotation* clone () const;
+
+    //! The default number of threads used to correct sub-integrations
+    static Option<unsigned> default_nthread;
+
     //! Set the rotation measure
     void set_rotation_measure (double rotation_measure)
     { set_measure (rotation_measure); }
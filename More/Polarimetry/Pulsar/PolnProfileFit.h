@@ -88,6 +88,15 @@ namespace Pulsar
     //! Set the standard to which observations will be fit
     void set_standard (const PolnProfile* standard);
 
+    //! The Fourier-domain products of a standard
+    class Standard;
+
+    //! Compute the Fourier-domain products of the standard
+    Standard* prepare_standard (const PolnProfile* standard);
+
+    //! Set the standard using products computed by prepare_standard
+    void set_standard (const Standard* prepared);
+
     //! Get the standard to which observations will be fit
     const PolnProfile* get_standard () const;
 
@@ -214,6 +223,9 @@ namespace Pulsar
 
     Stokes< std::complex<double> > standard_variance;
 
+    //! Build the measurement equation from the products of the standard
+    void build_equation (const Standard* prepared);
+
   private:
 
     //! True when the regions have been set
@@ -221,6 +233,31 @@ namespace Pulsar
 
   };
 
+  //! The Fourier-domain products of a standard
+  /*! These are computed once by PolnProfileFit::prepare_standard and
+    may be shared, read-only, by all fits to the same standard that
+    use the same maximum harmonic; e.g. by every channel when the
+    standard has a single frequency channel. */
+  class PolnProfileFit::Standard : public Reference::Able
+  {
+  public:
+
+    //! The standard
+    Reference::To<const PolnProfile> profile;
+
+    //! The Fourier transform of the standard
+    Reference::To<const PolnProfile> fourier;
+
+    //! The number of harmonics in the fit
+    unsigned nharmonic;
+
+    //! The complex Stokes parameters of harmonics 1 to nharmonic-1
+    std::vector< Stokes< std::complex<double> > > value;
+
+    //! The variances of the complex Stokes parameters
+    std::vector< Stokes< std::complex<double> > > variance;
+  };
+
 }
 
 #endif
@@ -13,14 +13,24 @@
 
 #include "Pulsar/Transformation.h"
 #include "Pulsar/Archive.h"
+#include "Quantiles.h"
 
 namespace Pulsar {
 
+  class ChannelStatistics;
+  class ProfileStats;
+
   //! Uses the inter-quartile range to find bad channels and sub-integrations
   /*! By default, this algorithm uses the modulation index as the
     statistic derived from each pulse profile and used to find
     outliers.  This behaviour can be changed by setting the expression
-    attribute. */
+    attribute.
+
+    The quartiles are found by linear-time selection or, if the
+    quantile error attribute is greater than zero, by a streaming
+    sketch with bounded memory.  In the latter case, the statistic
+    of each profile is not stored; it is evaluated again when the
+    outliers are flagged. */
   class InterQuartileRange : public Transformation<Archive>
   {
 
@@ -35,6 +45,23 @@ namespace Pulsar {
     //! Flag bad sub-integrations and frequency channels using IQR
     void once (Archive*);
 
+    //! Return the statistic derived from the specified profile
+    float get_statistic (Archive*, unsigned isubint, unsigned ichan);
+
+    //! Statistic of each profile (when the quartiles are found exactly)
+    std::vector<float> values;
+
+    //! Computes the quartiles of the statistic (when using the sketch)
+    Quantiles<float> quartiles;
+
+    //! Used to compute the default statistic in a single pass
+    /*! May be shared with other algorithms */
+    Reference::To<ChannelStatistics> channel_stats;
+
+    //! Used to evaluate the expression
+    Reference::To<ProfileStats> stats;
+    Reference::To<TextInterface::Parser> parser;
+
   protected:
 
     //! The mathematical expression to be evaluated on each Profile
@@ -45,6 +72,9 @@ namespace Pulsar {
 
     //! Maximum number of iterations before aborting
     unsigned max_iterations;
+
+    //! Maximum rank error of the quartiles (fraction of the sample size)
+    float quantile_error;
     
   public:
 
@@ -75,6 +105,21 @@ namespace Pulsar {
     //! Get the cut-off threshold
     float get_cutoff_threshold () const { return cutoff_threshold; }
 
+    //! Set the maximum rank error of the quartiles; zero means exact
+    void set_quantile_error (float e) { quantile_error = e; }
+
+    //! Get the maximum rank error of the quartiles
+    float get_quantile_error () const { return quantile_error; }
+
+    //! Set the channel statistics, which may be shared with other algorithms
+    /*! Used only when the expression is empty.  The statistics are
+      computed only if they were not already computed from the archive;
+      call ChannelStatistics::reset after modifying the data. */
+    void set_statistics (ChannelStatistics* s) { channel_stats = s; }
+
+    //! Get the channel statistics
+    ChannelStatistics* get_statistics () const { return channel_stats; }
+
   };
 
 }
@@ -13,6 +13,7 @@
 
 #include "Pulsar/Transformation.h"
 #include "Pulsar/Integration.h"
+#include "Pulsar/SmoothMedian.h"
 
 #include "TextInterface.h"
 #include "Functor.h"
@@ -51,6 +52,10 @@ namespace Pulsar {
     //! If set, search for spikes in fscrunched (DM=0) total
     virtual void set_broadband (bool);
 
+    //! Set the number of threads used to mow the channels
+    void set_nthread (unsigned);
+    unsigned get_nthread () const;
+
     //! If set, mow only the points flagged in the prune mask
     virtual void set_prune (const PhaseWeight* prune_mask);
     const PhaseWeight* get_prune () const;
@@ -84,6 +89,24 @@ namespace Pulsar {
     //! Preconditions
     std::vector< Functor< bool(Profile*,PhaseWeight*) > > precondition;
 
+    //! Number of threads used to mow the channels
+    unsigned nthread;
+
+    //! Channels of a sub-integration mowed by a single thread
+    class Block;
+
+    //! Mow the channels in the block
+    void mow_block (Block*);
+
+    //! Median smoothing, with storage reused for every profile
+    SmoothMedian median;
+
+    //! Median smoothed amplitudes
+    std::vector<float> smoothed;
+
+    //! Difference between the profile and its median smoothed amplitudes
+    Reference::To<Profile> difference;
+
   };
 
 }
@@ -0,0 +1,149 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by Willem van Straten
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// psrchive/More/Simulation/Pulsar/ShiftEstimatorBench.h
+
+#ifndef __Pulsar_ShiftEstimatorBench_h
+#define __Pulsar_ShiftEstimatorBench_h
+
+#include "Pulsar/SyntheticPolnProfile.h"
+#include "Pulsar/ShiftEstimator.h"
+
+#include "MEAL/RotatingVectorModel.h"
+#include "MEAL/Gaussian.h"
+
+#include <iostream>
+
+namespace Pulsar {
+
+  class PolnProfile;
+
+  //! Measures the speed and accuracy of phase shift estimators
+  /*! Simulated observations of a polarized Gaussian pulse with a
+    known phase shift are generated using SyntheticPolnProfile.  Each
+    estimator is applied to the same observations.  The time it takes
+    is measured, along with the bias and scatter of its shift estimates.
+
+    Shifts are defined as in ArrivalTime: a positive shift means that
+    the observed pulse arrives later than the standard.  Estimators
+    that do not use a standard (e.g. COF) are referenced to the shift
+    that they estimate for the noiseless standard.
+  */
+  class ShiftEstimatorBench : public Reference::Able
+  {
+  public:
+
+    //! Default constructor
+    ShiftEstimatorBench ();
+
+    //! Destructor
+    ~ShiftEstimatorBench ();
+
+    //! Set the number of phase bins in each simulated profile
+    void set_nbin (unsigned n) { nbin = n; }
+    unsigned get_nbin () const { return nbin; }
+
+    //! Set the signal-to-noise ratio of each simulated observation
+    void set_snr (double s) { snr = s; }
+    double get_snr () const { return snr; }
+
+    //! Set the width of the Gaussian pulse in turns
+    void set_width (double turns);
+
+    //! Set the number of simulated observations
+    void set_niteration (unsigned n) { niteration = n; }
+    unsigned get_niteration () const { return niteration; }
+
+    //! Add an estimator by name
+    /*! Any name understood by ShiftEstimator::factory, or MTM for
+      matrix template matching (as implemented by PolnProfileFit) */
+    void add_estimator (const std::string& name);
+
+    //! Add the estimators that may be used without configuration
+    void add_all_estimators ();
+
+    //! The results of benchmarking one estimator
+    class Result
+    {
+    public:
+
+      Result ();
+
+      //! The name of the estimator
+      std::string name;
+
+      //! The number of phase bins
+      unsigned nbin;
+
+      //! The signal-to-noise ratio of each observation
+      double snr;
+
+      //! The number of shifts estimated
+      unsigned ntoa;
+
+      //! The number of failed estimates
+      unsigned nfail;
+
+      //! The total time spent estimating shifts, in seconds
+      double seconds;
+
+      //! The mean difference between the estimated and true shifts, in turns
+      double bias;
+
+      //! The standard deviation of the estimated shifts, in turns
+      double scatter;
+
+      //! The rms of the formal uncertainties reported by the estimator
+      double error;
+
+      //! Return the number of shifts estimated per second
+      double get_rate () const;
+
+      //! Write the column names output by operator <<
+      static void header (std::ostream&);
+    };
+
+    //! Simulate observations and benchmark each estimator
+    void run (std::vector<Result>& results);
+
+  protected:
+
+    unsigned nbin;
+    double snr;
+    unsigned niteration;
+
+    //! The names of the estimators
+    std::vector<std::string> names;
+
+    //! The estimators (null for MTM)
+    std::vector< Reference::To<ShiftEstimator> > estimators;
+
+    //! The synthetic polarimetric profile generator
+    SyntheticPolnProfile generate;
+
+    //! The Gaussian total intensity profile
+    MEAL::Gaussian gaussian;
+
+    //! The rotating vector model of the position angle
+    MEAL::RotatingVectorModel rvm;
+
+    //! Set the phase of the pulse centre in turns
+    void set_centre (double turns);
+
+    //! Benchmark the specified estimator
+    Result measure (unsigned iest, const PolnProfile* standard,
+		    const std::vector< Reference::To<PolnProfile> >& obs,
+		    const std::vector<double>& shift);
+  };
+
+  //! Write the results on a single line
+  std::ostream& operator << (std::ostream&, const ShiftEstimatorBench::Result&);
+
+}
+
+#endif
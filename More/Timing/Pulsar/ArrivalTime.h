@@ -16,14 +16,18 @@
 #include "Estimate.h"
 #include "toa.h"
 
+class ThreadContext;
+
 namespace Pulsar {
 
   class ProfileShiftEstimator;
   class ShiftEstimator;
+  class PortraitShift;
   class Archive;
   class Integration;
   class Profile;
   class Flux;
+  class TOATable;
 
   //! Manages arrival time estimation
   /*! 
@@ -75,6 +79,16 @@ namespace Pulsar {
     //! Skip data with zero weight
     void set_skip_bad (bool flag) { skip_bad = flag; }
 
+    //! Format the auxiliary text of each arrival time
+    /*! Disable when the arrival times are written to a TOATable */
+    void set_auxiliary_text (bool flag) { auxiliary_text = flag; }
+
+    //! Set the number of threads used to fit the channels of each sub-integration
+    void set_nthread (unsigned n) { nthread = n; }
+
+    //! Get the number of threads used to fit the channels of each sub-integration
+    unsigned get_nthread () const { return nthread; }
+
     //! Add to the vector of time-of-arrival estimates
     void get_toas (std::vector<Tempo::toa>&);
 
@@ -128,14 +142,26 @@ namespace Pulsar {
     //! when true, skip data with zero weight
     bool skip_bad;
 
+    //! when true, format the auxiliary text of each arrival time
+    bool auxiliary_text;
+
+    //! the number of threads used to fit the channels of each sub-integration
+    unsigned nthread;
+
     /*
       Perhaps Tempo::toa::Format should be a base class, such that
       each child of the class does its own formatting
     */
     std::string get_tempo2_aux_txt (const Tempo::toa&);
 
+    /* Return the tempo2 flags; if toa is null, only those common to all */
+    std::string get_tempo2_aux_txt (const Tempo::toa*);
+
     /* Return the IPTA-specific tempo2 flags */
-    std::string get_ipta_aux_txt (const Tempo::toa&);
+    std::string get_ipta_aux_txt (const Tempo::toa*);
+
+    //! TOATable formats the columns that it writes
+    friend class TOATable;
 
     //! get the arrival times for the specified sub-integration
     virtual void get_toas (unsigned subint, std::vector<Tempo::toa>& toas);
@@ -146,10 +172,36 @@ namespace Pulsar {
     Tempo::toa get_toa (Estimate<double>& shift,
 			const Pulsar::Integration*, unsigned ichan);
 
+    //! Channels of a sub-integration fit by a single thread
+    class Block;
+
+    //! get the arrival times for the channels in the block
+    void get_block_toas (Block*);
+
+    //! Install a ThreadContext for the FFT plans, if none is installed
+    void start_threads ();
+
+    //! Restore the ThreadContext that was installed before start_threads
+    void finish_threads ();
+
+    //! The FFT plan ThreadContext that was installed before start_threads
+    ThreadContext* saved_context;
+
   private:
 
     void standard_update (unsigned ichan=0);
-    void setup (const Integration* subint, unsigned ichan);
+    void standard_update (unsigned ichan, ShiftEstimator*, Flux*);
+    void setup (const Integration* subint, unsigned ichan, ShiftEstimator*);
+
+    //! Estimate the arrival time in the specified channel
+    /*! Returns false if the channel is skipped or the fit fails */
+    bool estimate_toa (const Integration* subint, unsigned ichan,
+		       ShiftEstimator*, Flux*,
+		       Tempo::toa& arrival_time, Estimate<double>& shift);
+
+    //! Estimate a single arrival time from all channels
+    bool estimate_portrait_toa (const Integration* subint, PortraitShift*,
+				Tempo::toa& arrival_time);
 
   };
 
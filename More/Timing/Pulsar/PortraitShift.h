@@ -0,0 +1,128 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by Willem van Straten
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// psrchive/More/Timing/Pulsar/PortraitShift.h
+
+#ifndef __Pulsar_PortraitShift_h
+#define __Pulsar_PortraitShift_h
+
+#include "Pulsar/ShiftEstimator.h"
+
+namespace Pulsar {
+
+  class Integration;
+
+  //! Estimates the phase shift and dispersion measure from all channels
+  /*! A frequency-resolved standard (portrait) is fit to the total
+    intensity profiles of every channel of an Integration.  The
+    phase shift at the centre frequency and the dispersion measure
+    are shared by all channels; the amplitude of each channel is
+    solved analytically and therefore does not enter the non-linear
+    fit (see Pennucci, Demorest & Ransom 2014, ApJ 790, 93).
+
+    The profiles of all channels are transformed by a single batched
+    FFT and the cross-spectrum of each channel is computed once; each
+    Newton-Raphson iteration then evaluates the cross-correlation of
+    every channel, and its derivatives, using fft::harmonic_sum.
+    The noise in each channel is estimated from the upper half of its
+    harmonics.
+
+    A standard with a single channel is used for every channel of
+    the observation.
+  */
+  class PortraitShift : public ShiftEstimator
+  {
+
+  public:
+
+    //! Default constructor
+    PortraitShift ();
+
+    //! Set the frequency-resolved standard
+    void set_standard (const Integration*);
+
+    //! Set the observation
+    void set_observation (const Integration*);
+
+    //! Return the phase shift at the reference frequency
+    Estimate<double> get_shift () const;
+
+    //! Return the dispersion measure
+    Estimate<double> get_dispersion_measure () const;
+
+    //! Return the frequency at which the phase shift is estimated (MHz)
+    double get_reference_frequency () const;
+
+    //! Return the statistical goodness-of-fit
+    double get_reduced_chisq () const;
+
+    //! Return the S/N ratio of the observation (relative to the standard)
+    double get_snr () const;
+
+    //! Return a text interface that can be used to configure this instance
+    TextInterface::Parser* get_interface ();
+
+    //! Return a copy constructed instance of self
+    PortraitShift* clone () const { return new PortraitShift(*this); }
+
+    //! Fit for the dispersion measure
+    void set_fit_dispersion_measure (bool flag) { fit_dm = flag; }
+    bool get_fit_dispersion_measure () const { return fit_dm; }
+
+    //! Set the maximum number of Newton-Raphson iterations
+    /*! If the fit has not converged after this many iterations, an
+      exception is thrown and no arrival time is output */
+    void set_max_iterations (unsigned n) { max_iterations = n; }
+    unsigned get_max_iterations () const { return max_iterations; }
+
+    //! Set the convergence threshold in turns
+    void set_threshold (double t) { threshold = t; }
+    double get_threshold () const { return threshold; }
+
+  protected:
+
+    class Interface;
+
+    //! The standard
+    Reference::To<const Integration> standard;
+
+    //! The observation
+    Reference::To<const Integration> observation;
+
+    //! Fit for the dispersion measure
+    bool fit_dm;
+
+    //! Maximum number of Newton-Raphson iterations
+    unsigned max_iterations;
+
+    //! Convergence threshold in turns
+    double threshold;
+
+    //! Spectra of the standard, nbin+2 floats per channel
+    std::vector<float> standard_spectra;
+
+    //! Number of channels in the standard
+    unsigned standard_nchan;
+
+    //! Number of phase bins in the standard
+    unsigned standard_nbin;
+
+    mutable bool computed;
+    mutable Estimate<double> shift;
+    mutable Estimate<double> dispersion_measure;
+    mutable double reference_frequency;
+    mutable double reduced_chisq;
+    mutable double snr;
+
+    //! Perform the fit
+    void compute () const;
+  };
+
+}
+
+#endif // !defined __Pulsar_PortraitShift_h
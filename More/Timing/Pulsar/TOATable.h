@@ -0,0 +1,111 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by Willem van Straten
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// psrchive/More/Timing/Pulsar/TOATable.h
+
+#ifndef __Pulsar_TOATable_h
+#define __Pulsar_TOATable_h
+
+#include "ReferenceAble.h"
+#include "toa.h"
+
+#include <fitsio.h>
+
+namespace Pulsar {
+
+  class ArrivalTime;
+
+  //! Stores arrival time estimates in a FITS binary table
+  /*! Formatting the tempo2 auxiliary text of each arrival time requires
+    a look-up of every requested attribute, and each generic attribute
+    look-up constructs a new TextInterface parser.  A TOATable instead
+    writes the numerical properties of each arrival time to binary
+    columns.  The flags and attributes that are common to every arrival
+    time derived from an observation are formatted only once, and each
+    generic attribute is resolved only once for each observation.
+
+    The file contains two binary tables:
+
+    - ARCHIVE: the FILENAME, SITE, and common FLAGS of each observation;
+
+    - TOA: the ARCHIVE row number (starting from zero), SUBINT, CHAN,
+      FREQ (MHz), arrival time (IMJD, SMJD, and FRACSEC), ERROR (us),
+      GOF, SNR, WT, FLUX, FLUX_ERR, TOBS (s), and any AUX text added
+      by the shift estimator (e.g. -pp_dm) to each arrival time,
+      followed by a string column for each generic attribute.
+
+    The arrival times may be converted to tempo2 format using load.
+    The flags in each line are equivalent to those output by
+    ArrivalTime, though the flags that differ between arrival times
+    follow those that are common to all of them.
+  */
+  class TOATable : public Reference::Able
+  {
+  public:
+
+    //! Default constructor
+    TOATable ();
+
+    //! Destructor closes the file
+    ~TOATable ();
+
+    //! Create a new file, replacing any existing file with the same name
+    void create (const std::string& filename);
+
+    //! Open an existing file for reading
+    void open (const std::string& filename);
+
+    //! Close the file
+    void close ();
+
+    //! Append the arrival times derived from the current observation
+    /*! The attributes of the ArrivalTime are resolved on the first call */
+    void append (ArrivalTime*, const std::vector<Tempo::toa>&);
+
+    //! Load all of the arrival times, with tempo2 auxiliary text
+    void load (std::vector<Tempo::toa>&);
+
+    //! Maximum number of characters in each FILENAME
+    static const unsigned filename_width;
+
+    //! Maximum number of characters in the FLAGS of each observation
+    static const unsigned flags_width;
+
+    //! Maximum number of characters in each generic attribute value
+    static const unsigned value_width;
+
+    //! Maximum number of characters in the AUX text of each arrival time
+    static const unsigned aux_width;
+
+  protected:
+
+    //! The open file
+    fitsfile* fptr;
+
+    //! The name of the open file
+    std::string filename;
+
+    //! Number of rows in the ARCHIVE table
+    long narchive;
+
+    //! Number of rows in the TOA table
+    long ntoa;
+
+    //! The attributes added to each arrival time
+    std::vector<std::string> attributes;
+
+    //! The IPTA flags are included
+    bool ipta;
+
+    //! Create the binary tables
+    void setup (ArrivalTime*);
+  };
+
+}
+
+#endif
@@ -58,6 +58,28 @@ namespace FTransform {
 
     };
 
+    class PlanMany : public FTransform::PlanMany {
+
+    public:
+
+      //! Constructor
+      PlanMany (size_t nfft, size_t howmany,
+		size_t idist, size_t odist, type t);
+
+      //! Destructor
+      ~PlanMany ();
+
+      void fcc1d (float* dest, const float* src);
+      void bcc1d (float* dest, const float* src);
+      void frc1d (float* dest, const float* src);
+      void bcr1d (float* dest, const float* src);
+
+    protected:
+
+      void* plan;
+
+    };
+
     //! Agent class
     class Agent : public PlanAgent<FFTW3> {
     public:
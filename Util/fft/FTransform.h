@@ -88,8 +88,13 @@ namespace FTransform {
   //! Returns the scale factor associated with the FFT operation
   double get_scale (size_t nfft, type t);
 
+  //! Rotate an array by shift elements using the Fourier shift theorem
   void shift (unsigned npts, float* arr, double shift);
 
+  //! Rotate narray arrays of length npts, each by the corresponding shift
+  void shift (unsigned npts, unsigned narray,
+	      float* const* arr, const double* shift);
+
   //! Inplace wrapper-function- performs a memcpy after FFTing
   int inplace_frc1d(size_t nfft, float* srcdest);
   //! Inplace wrapper-function- performs a memcpy after FFTing
@@ -100,6 +105,36 @@ namespace FTransform {
   int inplace_bcr1d(size_t nfft, float* srcdest);
 
 
+  /* ////////////////////////////////////////////////////////////////////
+
+  Batched one-dimensional FFT library interface
+
+  Each function transforms howmany arrays of length nfft; the ith input
+  array starts at from + i*from_dist and the ith output array starts at
+  into + i*into_dist, where the distances are measured in floats.
+
+  //////////////////////////////////////////////////////////////////// */
+
+  //! Forward real-to-complex FFT of many arrays
+  void frc1d_many (size_t nfft, size_t howmany,
+		   float* into, size_t into_dist,
+		   const float* from, size_t from_dist);
+
+  //! Backward complex-to-real FFT of many arrays
+  void bcr1d_many (size_t nfft, size_t howmany,
+		   float* into, size_t into_dist,
+		   const float* from, size_t from_dist);
+
+  //! Forward complex-to-complex FFT of many arrays
+  void fcc1d_many (size_t nfft, size_t howmany,
+		   float* into, size_t into_dist,
+		   const float* from, size_t from_dist);
+
+  //! Backward complex-to-complex FFT of many arrays
+  void bcc1d_many (size_t nfft, size_t howmany,
+		   float* into, size_t into_dist,
+		   const float* from, size_t from_dist);
+
   /* ////////////////////////////////////////////////////////////////////
      
   Two-dimensional FFT library interface
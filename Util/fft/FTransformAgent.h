@@ -35,6 +35,10 @@ namespace FTransform {
     //! Return an appropriate two-dimensional FFT plan from this library
     virtual Plan2* get_plan2 (size_t nx, size_t ny, type call) = 0;
 
+    //! Return an appropriate batched one-dimensional FFT plan
+    virtual PlanMany* get_plan_many (size_t nfft, size_t howmany,
+				     size_t idist, size_t odist, type call) = 0;
+
     //! Clean up the plans for this library
     virtual void clean_plans () = 0;
 
@@ -73,7 +77,7 @@ namespace FTransform {
 
   //! Template virtual base class of FFT library agents
   /*! To use this template, the Library class must have nested classes
-    named Plan, Plan2, and Agent */
+    named Plan, Plan2, PlanMany, and Agent */
 
   template <class Library>
   class PlanAgent : public Agent {
@@ -89,6 +93,11 @@ namespace FTransform {
     //! Return an appropriate two-dimensional FFT plan from this library
     typename Library::Plan2* get_plan2 (size_t nx, size_t ny, type call);
 
+    //! Return an appropriate batched one-dimensional FFT plan
+    typename Library::PlanMany* get_plan_many (size_t nfft, size_t howmany,
+					       size_t idist, size_t odist,
+					       type call);
+
     //! Clean up the plans for this library
     void clean_plans ();
 
@@ -103,6 +112,9 @@ namespace FTransform {
     //! The two-dimensional plans managed by the agent for this library
     std::vector< Reference::To<typename Library::Plan2> > plans2;
 
+    //! The batched one-dimensional plans managed by the agent
+    std::vector< Reference::To<typename Library::PlanMany> > plans_many;
+
   };
 
   //! Clean up the plans for this library
@@ -110,6 +122,7 @@ namespace FTransform {
   void PlanAgent<Library>::clean_plans ()
   {
     plans.resize (0);
+    plans_many.resize (0);
   }
 
   template<class Library>
@@ -146,6 +159,22 @@ namespace FTransform {
     
   }
 
+  template<class Library>
+  typename Library::PlanMany*
+  PlanAgent<Library>::get_plan_many (size_t nfft, size_t howmany,
+				     size_t idist, size_t odist, type t)
+  {
+    ThreadContext::Lock lock (Agent::context);
+
+    for (unsigned iplan=0; iplan<plans_many.size(); iplan++)
+      if (plans_many[iplan]->matches (nfft, howmany, idist, odist, t))
+	return plans_many[iplan];
+
+    plans_many.push_back
+      ( new typename Library::PlanMany (nfft, howmany, idist, odist, t) );
+    return plans_many.back();
+  }
+
   template<class Library>
   void PlanAgent<Library>::enlist ()
   {
@@ -29,6 +29,11 @@ namespace FTransform {
     //! Set the number of threads for which benchmarks will be loaded
     void set_nthread (unsigned nthread);
 
+    //! Set the number of FFTs per batched plan for which to load benchmarks
+    /*! If nbatch is greater than one, benchmarks of batched plans are
+      loaded and costs are quoted per transform. */
+    void set_nbatch (unsigned nbatch);
+
     //! Get the maximum FFT length measured
     unsigned get_max_nfft () const;
 
@@ -46,6 +51,7 @@ namespace FTransform {
 
     std::string path;
     unsigned nthread;
+    unsigned nbatch;
 
     void reset ();
 
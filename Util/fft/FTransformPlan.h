@@ -69,6 +69,79 @@ namespace FTransform {
 
   };
 
+  //! Abstract base class of batched one-dimensional Fast Fourier Transforms
+  /*! Each plan transforms howmany arrays of length nfft.  The ith input
+    array starts idist floats after the first, and the ith output array
+    starts odist floats after the first. */
+  class PlanMany : public Reference::Able {
+  public:
+
+    virtual ~PlanMany () { }
+
+    //! Forward real-to-complex FFT of each array
+    virtual void frc1d (float* into, const float* from) = 0;
+
+    //! Backward complex-to-real FFT of each array
+    virtual void bcr1d (float* into, const float* from) = 0;
+
+    //! Forward complex-to-complex FFT of each array
+    virtual void fcc1d (float* into, const float* from) = 0;
+
+    //! Backward complex-to-complex FFT of each array
+    virtual void bcc1d (float* into, const float* from) = 0;
+
+    //! Return true if the plan matches the arguments
+    bool matches (size_t n, size_t h, size_t id, size_t od, type t)
+    { return nfft == n && howmany == h && idist == id && odist == od
+	&& call == t; }
+
+  protected:
+
+    bool optimized;
+    type call;
+    size_t nfft;
+    size_t howmany;
+    size_t idist;
+    size_t odist;
+
+  };
+
+  //! Batched FFT for libraries that do not implement it
+  /*! Each array is transformed by a one-dimensional plan of type P */
+  template<class P>
+  class PlanManyLoop : public PlanMany {
+
+  public:
+
+    PlanManyLoop (size_t n, size_t h, size_t id, size_t od, type t)
+    {
+      plan = new P (n, t);
+      nfft = n; howmany = h; idist = id; odist = od;
+      call = t; optimized = optimize;
+    }
+
+    void frc1d (float* into, const float* from)
+    { for (size_t i=0; i<howmany; i++)
+	plan->frc1d (nfft, into + i*odist, from + i*idist); }
+
+    void bcr1d (float* into, const float* from)
+    { for (size_t i=0; i<howmany; i++)
+	plan->bcr1d (nfft, into + i*odist, from + i*idist); }
+
+    void fcc1d (float* into, const float* from)
+    { for (size_t i=0; i<howmany; i++)
+	plan->fcc1d (nfft, into + i*odist, from + i*idist); }
+
+    void bcc1d (float* into, const float* from)
+    { for (size_t i=0; i<howmany; i++)
+	plan->bcc1d (nfft, into + i*odist, from + i*idist); }
+
+  protected:
+
+    Reference::To<P> plan;
+
+  };
+
   //! Base class for libraries that do not implement two-dimensional FFT
   class NotImplemented : public Plan2 {
 
@@ -46,6 +46,9 @@ namespace FTransform {
       Plan2 (size_t nx, size_t ny, type t) : NotImplemented ("IPP") {}
     };
   
+    //! Batched transforms loop over one-dimensional plans
+    typedef PlanManyLoop<Plan> PlanMany;
+
     class Agent : public PlanAgent<IPP> {
     public:
       Agent () : PlanAgent<IPP> ("IPP", unnormalized) { }
@@ -53,6 +53,9 @@ namespace FTransform {
 
     };
 
+    //! Batched transforms loop over one-dimensional plans
+    typedef PlanManyLoop<Plan> PlanMany;
+
     class Agent : public PlanAgent<MKL_DFTI> {
     public:
       Agent () : PlanAgent<MKL_DFTI> ("MKL_DFTI", unnormalized) { }
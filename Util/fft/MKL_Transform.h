@@ -41,6 +41,9 @@ namespace FTransform {
       Plan2 (size_t nx, size_t ny, type t) : NotImplemented ("MKL") {}
     };
 
+    //! Batched transforms loop over one-dimensional plans
+    typedef PlanManyLoop<Plan> PlanMany;
+
     class Agent : public PlanAgent<MKL> {
     public:
       Agent () : PlanAgent<MKL> ("MKL", normalized) { }
@@ -0,0 +1,43 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by Willem van Straten
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// psrchive/Util/fft/harmonic_sum.h
+
+#ifndef __fft_harmonic_sum_h
+#define __fft_harmonic_sum_h
+
+namespace fft {
+
+  //! Evaluate a band-limited periodic function and its derivatives
+  /*! For each of the nphi phases, phi (in turns), computes
+
+    \f[ f(\phi) = {\rm Re} \sum_{k=1}^{nharm} c_k \exp(i2\pi k\phi) \f]
+
+    and, if the corresponding pointers are non-null, the first and
+    second derivatives of f with respect to phi.  The complex
+    coefficients are stored as interleaved real and imaginary parts,
+    starting with the DC term (which is ignored), as in the output of
+    a real-to-complex FFT.
+
+    Instead of calling sin and cos for each harmonic, the phasor
+    exp(i2\pi k\phi) is advanced by complex multiplication; it is
+    recomputed exactly every 64 harmonics to bound the accumulation of
+    rounding error.  The phases are processed in blocks so that the
+    inner loop over phases may be vectorized by the compiler. */
+  void harmonic_sum (unsigned nharm, const float* spectrum,
+		     unsigned nphi, const double* phi,
+		     double* f, double* df = 0, double* d2f = 0);
+
+  //! Evaluate harmonic_sum by calling sin and cos for each harmonic
+  /*! This reference implementation is used to test harmonic_sum */
+  void harmonic_sum_direct (unsigned nharm, const float* spectrum,
+			    unsigned nphi, const double* phi,
+			    double* f, double* df = 0, double* d2f = 0);
+}
+
+#endif
@@ -11,6 +11,8 @@
 #ifndef __fft_smooth_h
 #define __fft_smooth_h
 
+#include "SlidingMedian.h"
+
 #include <algorithm>
 #include <vector>
 #include <iostream>
@@ -47,49 +49,12 @@ namespace fft {
     if (wsize%2 == 0)
       wsize ++;
 
-    unsigned ipt = 0, jpt = 0;
-
-    unsigned middle = wsize/2;
-    std::vector<T> window (wsize);
-
-    unsigned rsize = data.size() - wsize + 1;
     std::vector<T> result (data.size());
 
-    unsigned truncated = 0;
-    unsigned tmid = 0;
-    // deal with leading edge
-    for (ipt=0; ipt < middle; ipt++)
-    {
-      truncated = middle + 1 + ipt;
-      tmid = truncated / 2;
-      for (jpt=0; jpt < truncated; jpt++)
-	window[jpt] = data[jpt];
-      std::nth_element (window.begin(), window.begin()+tmid, 
-			window.begin()+truncated);
-      result[ipt] = window[tmid];
-    }
-
-    for (ipt=0; ipt < rsize; ipt++)
-    {
-      for (jpt=0; jpt<wsize; jpt++)
-	window[jpt] = data[ipt+jpt];
-      std::nth_element (window.begin(), window.begin()+middle, window.end());
-      result[ipt+middle] = window[middle];
-    }
-
-    // deal with trailing edge
-    for (ipt=rsize; ipt < data.size()-middle; ipt++)
-    {
-      truncated = data.size() - ipt;
-      tmid = truncated / 2;
-      for (jpt=0; jpt < truncated; jpt++)
-	window[jpt] = data[ipt+jpt];
-      std::nth_element (window.begin(), window.begin()+tmid,
-			window.begin()+truncated);
-      result[ipt+middle] = window[tmid];
-    }
+    SlidingMedian<T> window;
+    window.smooth_truncated (&(result[0]), &(data[0]), data.size(), wsize);
 
-    for (ipt=0; ipt < data.size(); ipt++)
+    for (unsigned ipt=0; ipt < data.size(); ipt++)
       data[ipt] = result[ipt];
  
   } // end median_smooth
@@ -30,6 +30,9 @@ public:
   //! Set the number of tasks that may run at one time
   void resize (unsigned nthread);
 
+  //! Get the number of tasks that may run at one time
+  unsigned get_nthread () const { return active.size(); }
+
   //! A single job in the queue
   class Job;
 
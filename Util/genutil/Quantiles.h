@@ -0,0 +1,278 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by Willem van Straten
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+/* Util/genutil/Quantiles.h */
+
+#ifndef __Quantiles_h
+#define __Quantiles_h
+
+#include <vector>
+#include <algorithm>
+#include <math.h>
+
+//! Computes quantiles of a sequence of values, exactly or approximately
+/*!
+  In Exact mode, the values are stored and the quantiles are found by
+  linear-time selection (std::nth_element); the values are partially
+  reordered but never sorted.  The q-quantile of n values is the
+  element with zero-based rank floor(q*n), clamped to n-1.  The same
+  selection may be performed on an array owned by the caller using the
+  static select method, without copying the values.
+
+  In Sketch mode, the values are summarized by the streaming algorithm
+  of Greenwald & Khanna (2001, SIGMOD 30:58).  The rank of the returned
+  element differs from floor(q*n) by no more than epsilon*n, and the
+  number of stored values grows only as O(log(epsilon*n)/epsilon).
+  Incoming values are buffered, sorted in batches of about 1/(2*epsilon),
+  and merged into the summary in a single pass.
+*/
+template<typename T>
+class Quantiles
+{
+public:
+
+  enum Mode { Exact, Sketch };
+
+  //! Default constructor
+  Quantiles (Mode m = Exact, double eps = 0.001)
+  { mode = m; epsilon = eps; count = 0; }
+
+  //! Set the mode; erases all values
+  void set_mode (Mode m) { mode = m; clear (); }
+  Mode get_mode () const { return mode; }
+
+  //! Set the maximum rank error (fraction of size) in Sketch mode
+  void set_epsilon (double eps) { epsilon = eps; clear (); }
+  double get_epsilon () const { return epsilon; }
+
+  //! Erases all of the values, without freeing the storage
+  void clear ()
+  {
+    values.clear ();
+    tuples.clear ();
+    count = 0;
+  }
+
+  //! Return the number of values added since the last call to clear
+  unsigned size () const { return count; }
+
+  //! Add a value
+  void add (const T& value)
+  {
+    values.push_back (value);
+    count ++;
+
+    if (mode == Sketch && values.size() >= get_batch_size())
+      flush ();
+  }
+
+  //! Get the q-quantile, where 0 <= q <= 1
+  T get (double q)
+  {
+    if (count == 0)
+      return T();
+
+    if (mode == Exact)
+    {
+      typename std::vector<T>::iterator nth = values.begin() + get_rank (q);
+      std::nth_element (values.begin(), nth, values.end());
+      return *nth;
+    }
+
+    flush ();
+    return query (q);
+  }
+
+  //! Get the quantiles of each element of q, which must be sorted
+  /*! In Exact mode, each selection searches only the values that lie
+    above the previous quantile. */
+  void get (const std::vector<double>& q, std::vector<T>& result)
+  {
+    result.resize (q.size());
+
+    if (count == 0)
+    {
+      std::fill (result.begin(), result.end(), T());
+      return;
+    }
+
+    if (mode == Sketch)
+    {
+      flush ();
+      for (unsigned i=0; i < q.size(); i++)
+        result[i] = query (q[i]);
+      return;
+    }
+
+    select (values, q, result);
+  }
+
+  //! Get the quantiles of each element of q, which must be sorted
+  /*! Selection is performed in place on the caller's values, which
+    are partially reordered, exactly as done in Exact mode. */
+  static void select (std::vector<T>& values, const std::vector<double>& q,
+                      std::vector<T>& result)
+  {
+    result.resize (q.size());
+
+    if (values.empty())
+    {
+      std::fill (result.begin(), result.end(), T());
+      return;
+    }
+
+    typename std::vector<T>::iterator first = values.begin();
+    for (unsigned i=0; i < q.size(); i++)
+    {
+      typename std::vector<T>::iterator nth
+        = values.begin() + get_rank (q[i], values.size());
+      if (nth < first)
+        nth = first;
+      std::nth_element (first, nth, values.end());
+      result[i] = *nth;
+      first = nth;
+    }
+  }
+
+  //! Return the number of values stored
+  unsigned get_storage () const { return values.size() + tuples.size(); }
+
+protected:
+
+  //! An element of the Greenwald-Khanna summary
+  class Tuple
+  {
+  public:
+    T value;
+    //! Difference between the minimum rank of this and the previous tuple
+    unsigned g;
+    //! Difference between the maximum and minimum rank of this tuple
+    unsigned delta;
+
+    Tuple (const T& v, unsigned _g, unsigned _d) : value(v), g(_g), delta(_d) {}
+  };
+
+  Mode mode;
+  double epsilon;
+  unsigned count;
+
+  //! All values (Exact) or values not yet merged into the summary (Sketch)
+  std::vector<T> values;
+
+  //! The summary, sorted by value
+  std::vector<Tuple> tuples;
+
+  //! Used to merge the buffered values into the summary
+  std::vector<Tuple> merged;
+
+  //! Zero-based rank of the q-quantile
+  unsigned get_rank (double q) const { return get_rank (q, count); }
+
+  //! Zero-based rank of the q-quantile of n values
+  static unsigned get_rank (double q, unsigned n)
+  {
+    if (q <= 0.0)
+      return 0;
+    unsigned rank = unsigned( floor (q * n) );
+    return std::min (rank, n-1);
+  }
+
+  unsigned get_batch_size () const
+  {
+    return std::max (unsigned(16), unsigned( 0.5 / epsilon ));
+  }
+
+  //! Maximum value of g+delta for any tuple
+  unsigned get_threshold () const
+  {
+    return unsigned( floor (2.0 * epsilon * count) );
+  }
+
+  //! Merge the buffered values into the summary and compress it
+  void flush ()
+  {
+    if (values.empty())
+      return;
+
+    std::sort (values.begin(), values.end());
+
+    merged.clear ();
+    merged.reserve (tuples.size() + values.size());
+
+    unsigned ival = 0;
+    for (unsigned i=0; i < tuples.size(); i++)
+    {
+      const Tuple& next = tuples[i];
+
+      // values smaller than the current minimum are exactly ranked
+      unsigned delta = (i == 0) ? 0 : next.g + next.delta - 1;
+
+      while (ival < values.size() && values[ival] < next.value)
+      {
+        merged.push_back (Tuple (values[ival], 1, delta));
+        ival ++;
+      }
+
+      merged.push_back (next);
+    }
+
+    // values larger than the current maximum are exactly ranked
+    for (; ival < values.size(); ival++)
+      merged.push_back (Tuple (values[ival], 1, 0));
+
+    tuples.swap (merged);
+    values.clear ();
+
+    compress ();
+  }
+
+  //! Merge each tuple into its successor while the error bound allows
+  /*! The first (minimum) and last (maximum) tuples are retained. */
+  void compress ()
+  {
+    unsigned ntuple = tuples.size();
+    if (ntuple < 3)
+      return;
+
+    const unsigned threshold = get_threshold ();
+
+    // index of the last tuple that has been kept, working backwards
+    unsigned kept = ntuple - 1;
+
+    for (unsigned i = ntuple-2; i > 0; i--)
+    {
+      Tuple& next = tuples[kept];
+      if (tuples[i].g + next.g + next.delta <= threshold)
+        next.g += tuples[i].g;
+      else
+        tuples[--kept] = tuples[i];
+    }
+
+    tuples[--kept] = tuples[0];
+    tuples.erase (tuples.begin(), tuples.begin() + kept);
+  }
+
+  //! Return the summarized value with rank within epsilon*count of q*count
+  T query (double q) const
+  {
+    double rank = get_rank (q) + 1;
+    double bound = rank + epsilon * count;
+
+    unsigned rmin = 0;
+    for (unsigned i=0; i < tuples.size(); i++)
+    {
+      rmin += tuples[i].g;
+      if (i > 0 && rmin + tuples[i].delta > bound)
+        return tuples[i-1].value;
+    }
+
+    return tuples.back().value;
+  }
+};
+
+#endif
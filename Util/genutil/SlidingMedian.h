@@ -0,0 +1,170 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by Willem van Straten
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+/* Util/genutil/SlidingMedian.h */
+
+#ifndef __SlidingMedian_h
+#define __SlidingMedian_h
+
+#include <vector>
+#include <algorithm>
+#include <functional>
+
+//! Running median of a sliding window that does not allocate memory
+/*!
+  The elements in the window are kept in a sorted array.  Sliding the
+  window by one element (see replace) finds the outgoing and incoming
+  elements by binary search and moves the elements between them by
+  one position.  Once the storage has been reserved, no memory is
+  allocated or freed.
+
+  Although each step is O(N) in the window size, N, the elements are
+  contiguous and are moved by a single block copy; for the windows
+  used to smooth profiles and spectra (up to about a thousand
+  elements), this is faster than the O(logN) RunningMedian, which
+  allocates and frees a tree node and rebalances the tree for every
+  element.  Run test_SlidingMedian with the half-width of the window
+  as its argument to compare the two.
+*/
+template< typename T, typename Compare = std::less<T> >
+class SlidingMedian
+{
+  std::vector<T> sorted;
+  Compare lt;
+  unsigned nth;
+
+  typedef typename std::vector<T>::iterator iterator;
+
+public:
+
+  SlidingMedian (unsigned n=0) { set_nth (n); }
+
+  //! Set the index of the median; reserves storage for 2*n+1 elements
+  void set_nth (unsigned n) { nth = n; reserve (2*n+1); }
+  unsigned get_nth () const { return nth; }
+
+  //! Reserve storage for the specified number of elements
+  void reserve (unsigned n) { sorted.reserve (n); }
+
+  //! Erases all of the elements, without freeing the storage
+  void clear () { sorted.clear(); }
+
+  //! Return the number of elements in the window
+  unsigned size () const { return sorted.size(); }
+
+  //! Insert an element
+  void insert (const T& element)
+  {
+    sorted.push_back (element);
+    iterator end = sorted.end() - 1;
+    iterator it = std::upper_bound (sorted.begin(), end, element, lt);
+    std::copy_backward (it, end, end+1);
+    *it = element;
+  }
+
+  //! Erase an element
+  void erase (const T& element)
+  {
+    iterator it = std::lower_bound (sorted.begin(), sorted.end(), element, lt);
+    std::copy (it+1, sorted.end(), it);
+    sorted.pop_back ();
+  }
+
+  //! Replace an element with another; equivalent to erase then insert
+  void replace (const T& out, const T& in)
+  {
+    iterator hole = std::lower_bound (sorted.begin(), sorted.end(), out, lt);
+
+    if (lt( out, in ))
+    {
+      // shift the elements between the hole and in to the left
+      iterator it = std::lower_bound (hole+1, sorted.end(), in, lt);
+      std::copy (hole+1, it, hole);
+      *(it-1) = in;
+    }
+    else
+    {
+      // shift the elements between in and the hole to the right
+      iterator it = std::upper_bound (sorted.begin(), hole, in, lt);
+      std::copy_backward (it, hole, hole+1);
+      *it = in;
+    }
+  }
+
+  //! Get the nth element
+  const T& get_median () const { return sorted[nth]; }
+
+  //! Get the ith smallest element
+  const T& operator[] (unsigned i) const { return sorted[i]; }
+
+  //! Median smooth an array with periodic boundary conditions
+  /*! The window width must be odd and no greater than ndat. */
+  void smooth_cyclic (T* result, const T* data, unsigned ndat, unsigned width)
+  {
+    set_nth (width/2);
+    clear ();
+
+    for (unsigned i=0; i < width; i++)
+      insert (data[i]);
+
+    unsigned middle = nth;
+    unsigned front = 0;
+    unsigned back = width % ndat;
+
+    for (unsigned i=0; i < ndat; i++)
+    {
+      result[middle] = get_median ();
+      replace (data[front], data[back]);
+
+      if (++middle == ndat) middle = 0;
+      if (++front == ndat) front = 0;
+      if (++back == ndat) back = 0;
+    }
+  }
+
+  //! Median smooth an array, truncating the window at the edges
+  /*! Near the edges, the median of the elements that fall within the
+    window is used.  The window width must be odd and no greater than
+    ndat. */
+  void smooth_truncated (T* result, const T* data, unsigned ndat,
+			 unsigned width)
+  {
+    const unsigned middle = width/2;
+    const unsigned rsize = ndat - width + 1;
+
+    set_nth (middle);
+    clear ();
+
+    // leading edge: the window grows from middle+1 to width elements
+    for (unsigned i=0; i <= middle; i++)
+      insert (data[i]);
+
+    for (unsigned i=0; i < middle; i++)
+    {
+      result[i] = sorted[sorted.size()/2];
+      insert (data[middle+1+i]);
+    }
+
+    for (unsigned i=0; i < rsize; i++)
+    {
+      result[i+middle] = get_median ();
+      if (i+1 < rsize)
+	replace (data[i], data[i+width]);
+    }
+
+    // trailing edge: the window shrinks from width-1 to middle+1 elements
+    for (unsigned i=rsize; i < ndat-middle; i++)
+    {
+      erase (data[i-1]);
+      result[i+middle] = sorted[sorted.size()/2];
+    }
+  }
+
+};
+
+#endif
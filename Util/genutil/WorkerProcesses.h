@@ -0,0 +1,93 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by Willem van Straten
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// psrchive/Util/genutil/WorkerProcesses.h
+
+#ifndef __WorkerProcesses_h
+#define __WorkerProcesses_h
+
+#include <vector>
+#include <string>
+#include <stdio.h>
+
+//! Performs the iterations of a loop over files in worker processes
+/*! Each iteration is performed by a child process created with fork.
+  The standard output and error of each child are written to temporary
+  files and copied to those of the parent in the order of the files.
+  A loop over a vector of filenames is written as
+
+  WorkerProcesses workers (nproc);
+  for (unsigned i = workers.start (filenames); i < filenames.size();
+       i = workers.next (i))
+    process (filenames[i]);
+
+  In the parent process, start runs all of the workers and returns the
+  number of files after the last worker has finished.  In each worker,
+  start returns the index of the file to be processed, and next flushes
+  the output and terminates the worker.  If nproc is less than two, no
+  worker processes are created and the loop runs as usual.
+
+  Because each worker has its own copy of the process, no state is
+  shared between iterations; loops that accumulate results over
+  multiple files must not use worker processes.
+*/
+class WorkerProcesses
+{
+
+public:
+
+  //! Construct with the maximum number of worker processes
+  WorkerProcesses (unsigned nproc = 1);
+
+  //! Set the maximum number of worker processes
+  void set_nproc (unsigned n) { nproc = n; }
+
+  //! Get the maximum number of worker processes
+  unsigned get_nproc () const { return nproc; }
+
+  //! Return the index of the first file to be processed by this process
+  unsigned start (const std::vector<std::string>& filenames);
+
+  //! Return the index of the next file to be processed by this process
+  unsigned next (unsigned ifile);
+
+  //! Return true if this is a worker process
+  bool get_worker () const { return worker; }
+
+protected:
+
+  //! The standard output and error of a worker
+  class Output
+  {
+  public:
+    int pid;
+    FILE* out;
+    FILE* err;
+    bool done;
+
+    Output () { pid = 0; out = err = 0; done = false; }
+  };
+
+  //! The maximum number of worker processes
+  unsigned nproc;
+
+  //! The number of files
+  unsigned nfile;
+
+  //! True in a worker process
+  bool worker;
+
+  //! Flush the standard output and error
+  static void flush ();
+
+  //! Copy the contents of a temporary file and close it
+  static void copy_and_close (FILE* from, FILE* to);
+
+};
+
+#endif
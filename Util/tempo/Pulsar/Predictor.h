@@ -77,6 +77,16 @@ namespace Pulsar {
     //! Return the spin frequency, given the epoch
     virtual long double frequency (const MJD& t) const = 0;
 
+    //! Return the phase at each of n epochs
+    /*! The default implementation calls phase for each epoch; derived
+      classes may amortize the cost of locating the model component
+      that spans each epoch, especially when the epochs are sorted. */
+    virtual void phases (unsigned n, const MJD* t, Phase* result) const;
+
+    //! Return the spin frequency at each of n epochs
+    virtual void frequencies (unsigned n, const MJD* t,
+			      long double* result) const;
+
     //! Return the phase correction for dispersion delay
     virtual Phase dispersion (const MJD &t, long double MHz) const = 0;
 
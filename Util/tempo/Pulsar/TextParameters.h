@@ -42,6 +42,9 @@ namespace Pulsar {
     //! Set the text
     void set_text (const std::string& t) { text = t; }
 
+    //! Get the text
+    const std::string& get_text () const { return text; }
+
     //! Retrieve a string from the text
     std::string get_value (const std::string& keyword) const;
 
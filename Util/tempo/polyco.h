@@ -85,6 +85,12 @@ protected:
   //! used by polyco::keep to determine if this polynomial is used
   mutable bool keep;
 
+  //! Returns the pulse phase at tm minutes after ref_time
+  Pulsar::Phase phase_minutes (long double tm) const;
+
+  //! Returns the spin frequency at tm minutes after ref_time
+  long double frequency_minutes (long double tm) const;
+
 public:
 
   //! Interface for setting attributes
@@ -259,6 +265,12 @@ public:
   long double frequency (const MJD& t) const
   { return best(t).frequency(t); }
 
+  //! Return the phase at each of n epochs
+  void phases (unsigned n, const MJD* t, Pulsar::Phase* result) const;
+
+  //! Return the spin frequency at each of n epochs
+  void frequencies (unsigned n, const MJD* t, long double* result) const;
+
   //! Return the phase correction for dispersion delay
   Pulsar::Phase dispersion (const MJD &t, long double MHz) const
   { return best(t).dispersion(t,MHz); }
@@ -351,6 +363,11 @@ private:
 
   void init();
   void set_last (int i) const;
+
+  //! Evaluate method at each of n epochs
+  template<typename T>
+  void evaluate (unsigned n, const MJD* t, T* result,
+		 T (polynomial::*method) (long double) const) const;
 };
 
 inline std::ostream& operator<< (std::ostream& ostr, const polyco& p)
@@ -64,6 +64,12 @@ namespace Tempo2 {
     //! Name of file containing list of Tempo2 keywords
     static Configuration::Parameter<std::string>& get_keyword_filename();
 
+    //! Generate the predictor using the tempo2 library (default: false)
+    static Configuration::Parameter<bool>& get_in_process();
+
+    //! Maximum number of generated predictors that are kept for reuse
+    static Configuration::Parameter<unsigned>& get_cache_size();
+
   private:
 
     //! The parameters used to generate the predictor
@@ -77,6 +83,31 @@ namespace Tempo2 {
     //! length of each segment in days
     long double segment_length;
 
+    //! hash of the parameters text, used to quickly rule out cache entries
+    unsigned long parameters_hash;
+
+    //! Get the range of epochs spanned by the generated predictor
+    void get_span (long double& start, long double& finish) const;
+
+  protected:
+
+    //! Return true if the cached generator produced a predictor like self
+    bool covered_by (const Generator* cached) const;
+
+    //! Return a previously generated predictor that matches, if any
+    Predictor* cache_lookup () const;
+
+    //! Keep the generated predictor for reuse
+    void cache_insert (const Predictor*) const;
+
+  private:
+
+    //! Run tempo2 -pred and load the predictor from the output file
+    void execute (Predictor*, long double start, long double finish) const;
+
+    //! Construct the predictor using the tempo2 library
+    void construct (Predictor*, long double start, long double finish) const;
+
     template<typename T> void work_around_tempo2_tzr_bug (T& psr) const;
   };
 
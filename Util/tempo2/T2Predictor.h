@@ -90,6 +90,12 @@ namespace Tempo2 {
     //! Return the spin frequency, given the epoch
     long double frequency (const MJD& t) const;
 
+    //! Return the phase at each of n epochs
+    void phases (unsigned n, const MJD* t, Pulsar::Phase* result) const;
+
+    //! Return the spin frequency at each of n epochs
+    void frequencies (unsigned n, const MJD* t, long double* result) const;
+
     //! Return the phase correction for dispersion delay
     Pulsar::Phase dispersion (const MJD &t, long double MHz) const;
 
@@ -31,6 +31,12 @@ namespace Reference {
     };
 
     myKlass can now be managed using a Reference::To<myKlass>.
+
+    When compiled with POSIX threads, distinct Reference::To instances
+    that point to the same object may be copied and destroyed
+    concurrently by different threads.  If the package is configured
+    with --enable-atomic-reference, the reference counts are modified
+    using atomic operations instead of a single global mutex.
   */
   class Able : public HeapTracked {
 
@@ -54,7 +60,7 @@ namespace Reference {
     virtual ~Able();
     
     //! Returns the number of references there are to this
-    unsigned get_reference_count() const { return __reference_count; }
+    unsigned get_reference_count() const;
 
     //! Returns the current number instances in existence
     static size_t get_instance_count ();
@@ -8,11 +8,18 @@
 # TEMPO2_LIBS   - autoconfig variable with flags required for linking
 # HAVE_TEMPO2   - automake conditional
 # HAVE_TEMPO2   - pre-processor macro in config.h
+# HAVE_TEMPO2_LIBRARY - pre-processor macro in config.h
 #
 # This macro tries to link a test program, using 
 #
 #    -I$TEMPO2/include -L$TEMPO2/lib -ltempo2pred
 #
+# If successful, it then tries to link with the full TEMPO2 library
+#
+#    -L$TEMPO2/lib -ltempo2 -ltempo2pred
+#
+# which enables in-process generation of TEMPO2 predictors.
+#
 # Notice that the environment variable TEMPO2 is required.
 #
 # ----------------------------------------------------------
@@ -39,6 +46,30 @@ AC_DEFUN([SWIN_LIB_TEMPO2],
 
   AC_MSG_RESULT($have_tempo2)
 
+  if test x"$have_tempo2" = xyes; then
+
+    AC_MSG_CHECKING([for TEMPO2 library])
+
+    LIBS="$ac_save_LIBS -L$TEMPO2/lib -ltempo2 $TEMPO2_LIBS"
+
+    AC_TRY_LINK([#include "tempo2.h"
+                 #include "tempo2pred_int.h"],
+                [pulsar* psr = 0; ChebyModelSet cms;
+                 initialiseOne (psr, 1, 1);
+                 ChebyModelSet_Construct (&cms, psr, "", 0, 0, 0, 0,
+                                          0, 0, 0, 0);],
+                have_tempo2_library=yes, have_tempo2_library=no)
+
+    AC_MSG_RESULT($have_tempo2_library)
+
+    if test x"$have_tempo2_library" = xyes; then
+      AC_DEFINE([HAVE_TEMPO2_LIBRARY], [1],
+                [Define to 1 if you have the full TEMPO2 library])
+      TEMPO2_LIBS="-L$TEMPO2/lib -ltempo2 $TEMPO2_LIBS"
+    fi
+
+  fi
+
   LIBS="$ac_save_LIBS"
   CXXFLAGS="$ac_save_CXXFLAGS"
 